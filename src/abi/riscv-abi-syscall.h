@@ -0,0 +1,75 @@
+//
+//  riscv-abi-syscall.h
+//
+
+#ifndef riscv_abi_syscall_h
+#define riscv_abi_syscall_h
+
+namespace riscv {
+
+	/* proxy ABI syscall numbers (Linux generic values) */
+
+	enum abi_syscall
+	{
+		abi_syscall_dup = 23,
+		abi_syscall_dup3 = 24,
+		abi_syscall_fcntl = 25,
+		abi_syscall_openat = 56,
+		abi_syscall_close = 57,
+		abi_syscall_lseek = 62,
+		abi_syscall_read = 63,
+		abi_syscall_write = 64,
+		abi_syscall_readv = 65,
+		abi_syscall_writev = 66,
+		abi_syscall_pread = 67,
+		abi_syscall_pwrite = 68,
+		abi_syscall_preadv = 69,
+		abi_syscall_pwritev = 70,
+		abi_syscall_sendfile = 71,
+		abi_syscall_fstat = 80,
+		abi_syscall_exit = 93,
+		abi_syscall_clock_gettime = 113,
+		abi_syscall_gettimeofday = 169,
+		abi_syscall_brk = 214,
+		abi_syscall_munmap = 215,
+		abi_syscall_mremap = 216,
+		abi_syscall_mmap = 222,
+		abi_syscall_mprotect = 226,
+		abi_syscall_copy_file_range = 285,
+	};
+
+	inline const char* abi_syscall_name(int number)
+	{
+		switch (number) {
+			case abi_syscall_dup:              return "dup";
+			case abi_syscall_dup3:             return "dup3";
+			case abi_syscall_fcntl:            return "fcntl";
+			case abi_syscall_openat:           return "openat";
+			case abi_syscall_close:            return "close";
+			case abi_syscall_lseek:            return "lseek";
+			case abi_syscall_read:             return "read";
+			case abi_syscall_write:            return "write";
+			case abi_syscall_readv:            return "readv";
+			case abi_syscall_writev:           return "writev";
+			case abi_syscall_pread:            return "pread";
+			case abi_syscall_pwrite:           return "pwrite";
+			case abi_syscall_preadv:           return "preadv";
+			case abi_syscall_pwritev:          return "pwritev";
+			case abi_syscall_sendfile:         return "sendfile";
+			case abi_syscall_fstat:            return "fstat";
+			case abi_syscall_exit:             return "exit";
+			case abi_syscall_clock_gettime:    return "clock_gettime";
+			case abi_syscall_gettimeofday:     return "gettimeofday";
+			case abi_syscall_brk:              return "brk";
+			case abi_syscall_munmap:           return "munmap";
+			case abi_syscall_mremap:           return "mremap";
+			case abi_syscall_mmap:             return "mmap";
+			case abi_syscall_mprotect:         return "mprotect";
+			case abi_syscall_copy_file_range:  return "copy_file_range";
+			default: return nullptr;
+		}
+	}
+
+}
+
+#endif
@@ -0,0 +1,238 @@
+//
+//  riscv-fd-table.h
+//
+
+#ifndef riscv_fd_table_h
+#define riscv_fd_table_h
+
+namespace riscv {
+
+	/* guest open and fcntl flags (Linux generic values) */
+
+	enum abi_open_flag
+	{
+		abi_o_rdonly = 00,
+		abi_o_wronly = 01,
+		abi_o_rdwr = 02,
+		abi_o_accmode = 03,
+		abi_o_creat = 0100,
+		abi_o_excl = 0200,
+		abi_o_noctty = 0400,
+		abi_o_trunc = 01000,
+		abi_o_append = 02000,
+		abi_o_nonblock = 04000,
+		abi_o_dsync = 010000,
+		abi_o_directory = 0200000,
+		abi_o_nofollow = 0400000,
+		abi_o_cloexec = 02000000,
+		abi_at_fdcwd = -100,
+		abi_f_dupfd = 0,
+		abi_f_getfd = 1,
+		abi_f_setfd = 2,
+		abi_f_getfl = 3,
+		abi_f_setfl = 4,
+		abi_f_dupfd_cloexec = 1030,
+	};
+
+
+	/*
+	 * fd_memfile
+	 *
+	 * read-only input file held in memory, shared by all guests. The
+	 * file is mapped with its pages populated when it is preloaded so
+	 * guest reads are served from RAM without host file I/O. The host
+	 * fd stays open so guest mmaps can map the same resident pages.
+	 */
+
+	struct fd_memfile
+	{
+		std::string path;
+		int fd;                              /* host fd of the file */
+		const u8 *data;                      /* mapped contents, null if empty */
+		size_t size;
+		struct stat st;
+
+		fd_memfile(std::string path) : path(path), fd(-1), data(nullptr), size(0), st() {}
+		fd_memfile(const fd_memfile&) = delete;
+
+		~fd_memfile()
+		{
+			if (data) munmap((void*)data, size);
+			if (fd >= 0) ::close(fd);
+		}
+	};
+
+
+	/*
+	 * fd_preload
+	 *
+	 * set of preloaded input files, looked up by path when a guest opens
+	 * a file read-only. The path is matched as given and then by its
+	 * canonical host path.
+	 */
+
+	struct fd_preload
+	{
+		std::map<std::string,std::shared_ptr<fd_memfile>> files;
+
+		bool add(const char *path)
+		{
+			std::shared_ptr<fd_memfile> mf = std::make_shared<fd_memfile>(path);
+			if ((mf->fd = ::open(path, O_RDONLY | O_CLOEXEC)) < 0) return false;
+			if (fstat(mf->fd, &mf->st) < 0) return false;
+			if (!S_ISREG(mf->st.st_mode)) {
+				errno = EINVAL; /* only regular files can be mapped */
+				return false;
+			}
+			if (mf->st.st_size > 0) {
+				int flags = MAP_PRIVATE;
+			#if defined (MAP_POPULATE)
+				flags |= MAP_POPULATE;
+			#endif
+				void *addr = mmap(nullptr, size_t(mf->st.st_size), PROT_READ, flags, mf->fd, 0);
+				if (addr == MAP_FAILED) return false;
+				mf->data = (const u8*)addr;
+				mf->size = size_t(mf->st.st_size);
+				madvise(addr, mf->size, MADV_WILLNEED);
+			}
+			files[path] = mf;
+			char *real = realpath(path, nullptr);
+			if (real) {
+				files[real] = mf;
+				free(real);
+			}
+			return true;
+		}
+
+		std::shared_ptr<fd_memfile> lookup(const char *path)
+		{
+			if (files.empty()) return nullptr;
+			auto fi = files.find(path);
+			if (fi != files.end()) return fi->second;
+			char *real = realpath(path, nullptr);
+			if (!real) return nullptr;
+			fi = files.find(real);
+			free(real);
+			return fi != files.end() ? fi->second : nullptr;
+		}
+	};
+
+
+	/*
+	 * fd_file
+	 *
+	 * open file description shared by duplicated guest fds. Either a host
+	 * fd or a preloaded memory file with its own file position.
+	 */
+
+	struct fd_file
+	{
+		int host_fd;                         /* host fd or -1 for memory files */
+		bool owned;                          /* close host_fd with the last reference */
+		std::shared_ptr<fd_memfile> mem;     /* preloaded file contents */
+		off_t pos;                           /* memory file position */
+		int status_flags;                    /* guest open flags */
+
+		fd_file(int host_fd, bool owned, int status_flags) :
+			host_fd(host_fd), owned(owned), mem(), pos(0), status_flags(status_flags) {}
+
+		fd_file(std::shared_ptr<fd_memfile> mem, int status_flags) :
+			host_fd(-1), owned(false), mem(mem), pos(0), status_flags(status_flags) {}
+
+		fd_file(const fd_file&) = delete;
+
+		~fd_file() { if (owned && host_fd >= 0) ::close(host_fd); }
+	};
+
+
+	/*
+	 * fd_table
+	 *
+	 * per-guest file descriptor table mapping guest fds to open files
+	 *
+	 * Guest fds 0-2 refer to the host standard streams, which the guest
+	 * can close without closing them in the emulator.
+	 */
+
+	struct fd_table
+	{
+		enum { fd_cloexec = 1, fd_max = 1024 };
+
+		struct fd_slot
+		{
+			std::shared_ptr<fd_file> file;
+			int fd_flags;
+		};
+
+		std::vector<fd_slot> slots;
+		fd_preload *preload;
+
+		fd_table() : slots(), preload(nullptr)
+		{
+			for (int fd = 0; fd < 3; fd++) {
+				install(std::make_shared<fd_file>(fd, false, fd == 0 ? abi_o_rdonly : abi_o_wronly), fd, 0);
+			}
+		}
+
+		fd_file* get(int fd)
+		{
+			return fd >= 0 && size_t(fd) < slots.size() ? slots[fd].file.get() : nullptr;
+		}
+
+		/* host fd for a guest fd, -1 for memory files and closed fds */
+		int host_fd(int fd)
+		{
+			fd_file *f = get(fd);
+			return f ? f->host_fd : -1;
+		}
+
+		/* install at the lowest free fd >= min_fd, returns -EMFILE if full */
+		int install(std::shared_ptr<fd_file> file, int min_fd, int fd_flags)
+		{
+			for (int fd = min_fd; fd < fd_max; fd++) {
+				if (size_t(fd) >= slots.size()) slots.resize(fd + 1);
+				if (slots[fd].file) continue;
+				slots[fd].file = file;
+				slots[fd].fd_flags = fd_flags;
+				return fd;
+			}
+			return -EMFILE;
+		}
+
+		int close(int fd)
+		{
+			if (!get(fd)) return -EBADF;
+			slots[fd].file.reset();
+			return 0;
+		}
+
+		int dup(int fd, int min_fd, int fd_flags)
+		{
+			if (!get(fd)) return -EBADF;
+			if (min_fd < 0 || min_fd >= fd_max) return -EINVAL;
+			return install(slots[fd].file, min_fd, fd_flags);
+		}
+
+		int dup3(int oldfd, int newfd, int fd_flags)
+		{
+			if (!get(oldfd)) return -EBADF;
+			if (newfd < 0 || newfd >= fd_max || oldfd == newfd) return -EINVAL;
+			if (size_t(newfd) >= slots.size()) slots.resize(newfd + 1);
+			slots[newfd].file = slots[oldfd].file;
+			slots[newfd].fd_flags = fd_flags;
+			return newfd;
+		}
+
+		int get_fd_flags(int fd) { return get(fd) ? slots[fd].fd_flags : -EBADF; }
+
+		int set_fd_flags(int fd, int fd_flags)
+		{
+			if (!get(fd)) return -EBADF;
+			slots[fd].fd_flags = fd_flags & fd_cloexec;
+			return 0;
+		}
+	};
+
+}
+
+#endif
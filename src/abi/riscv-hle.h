@@ -0,0 +1,384 @@
+//
+//  riscv-hle.h
+//
+
+#ifndef riscv_hle_h
+#define riscv_hle_h
+
+namespace riscv {
+
+	/*
+	 * high-level emulation of libc memory and string routines
+	 *
+	 * The first instruction of each known guest routine is replaced with
+	 * the 16-bit all zeros illegal instruction. The proxy traps it, runs
+	 * the host routine on guest memory, sets a0 and returns to ra.
+	 *
+	 * In verify mode the host result is computed without touching guest
+	 * memory, ra is pointed at a return trap and the original instruction
+	 * is executed so the guest routine is interpreted. The return trap
+	 * compares the interpreted result with the host result and returns
+	 * to the caller.
+	 *
+	 * The malloc family is served from a host TLSF allocator whose pools
+	 * are guest memory, starting with a pool at the base of the guest
+	 * heap. The aligned allocators, malloc_usable_size and the newlib
+	 * reentrant entry points are replaced as well so that every pointer
+	 * the guest frees or queries comes from the same pool. Allocator calls
+	 * are never verified as the guest and host allocators can not be mixed.
+	 */
+
+	enum hle_fn
+	{
+		hle_fn_memcpy,
+		hle_fn_memmove,
+		hle_fn_memset,
+		hle_fn_memcmp,
+		hle_fn_strlen,
+		hle_fn_strcmp,
+		hle_fn_malloc,
+		hle_fn_free,
+		hle_fn_calloc,
+		hle_fn_realloc,
+		hle_fn_malloc_r,
+		hle_fn_free_r,
+		hle_fn_calloc_r,
+		hle_fn_realloc_r,
+		hle_fn_memalign,
+		hle_fn_posix_memalign,
+		hle_fn_aligned_alloc,
+		hle_fn_valloc,
+		hle_fn_pvalloc,
+		hle_fn_malloc_usable_size,
+		hle_fn_memalign_r,
+		hle_fn_valloc_r,
+		hle_fn_pvalloc_r,
+		hle_fn_malloc_usable_size_r,
+		hle_fn_count
+	};
+
+	inline const char* hle_fn_name(int fn)
+	{
+		static const char* names[] = {
+			"memcpy", "memmove", "memset", "memcmp", "strlen", "strcmp",
+			"malloc", "free", "calloc", "realloc",
+			"_malloc_r", "_free_r", "_calloc_r", "_realloc_r",
+			"memalign", "posix_memalign", "aligned_alloc", "valloc", "pvalloc",
+			"malloc_usable_size", "_memalign_r", "_valloc_r", "_pvalloc_r",
+			"_malloc_usable_size_r"
+		};
+		return fn >= 0 && fn < hle_fn_count ? names[fn] : "unknown";
+	}
+
+	inline bool hle_fn_is_alloc(int fn) { return fn >= hle_fn_malloc && fn < hle_fn_count; }
+
+	struct hle_entry
+	{
+		hle_fn fn;
+		inst_t orig_inst;                    /* first instruction of the guest routine */
+		addr_t orig_len;
+		u64 calls;
+	};
+
+	struct hle_verify_frame
+	{
+		hle_entry *ent;
+		addr_t ra;                           /* caller return address */
+		u64 result;                          /* host a0 */
+		addr_t dst;                          /* host memory result */
+		std::vector<u8> expect;
+	};
+
+	struct hle_table
+	{
+		std::map<addr_t,hle_entry> entries;  /* keyed by routine entry */
+		std::vector<hle_verify_frame> frames;
+		addr_t ret_trap;                     /* verify mode return address */
+		bool verify;
+		u64 verify_count;
+		u64 mismatch_count;
+		tlsf_t heap;                         /* guest malloc pools */
+		size_t heap_chunk;                   /* minimum pool size */
+
+		hle_table() : ret_trap(0), verify(false), verify_count(0), mismatch_count(0),
+			heap(nullptr), heap_chunk(0) {}
+
+		/* patch the routine at pc, prot is the protection of its text mapping */
+		bool patch(hle_fn fn, addr_t pc, int prot)
+		{
+			addr_t pc_offset;
+			inst_t inst = inst_fetch(pc, pc_offset);
+			addr_t page = pc & page_mask;
+			size_t len = size_t(round_up(pc + 2, page_size) - page);
+			if (mprotect((void*)page, len, prot | PROT_WRITE) < 0) return false;
+			*(u16*)pc = 0;
+			mprotect((void*)page, len, prot);
+			entries[pc] = hle_entry{ fn, inst, pc_offset, 0 };
+			return true;
+		}
+
+		/* print verification results */
+		void report()
+		{
+			if (!verify) return;
+			for (auto &ent : entries) {
+				debug("hle: %-8s %llu calls", hle_fn_name(ent.second.fn),
+					(unsigned long long)ent.second.calls);
+			}
+			debug("hle: verified %llu calls, %llu mismatches",
+				(unsigned long long)verify_count, (unsigned long long)mismatch_count);
+		}
+
+		hle_entry* lookup(addr_t pc)
+		{
+			auto ei = entries.find(pc);
+			return ei != entries.end() ? &ei->second : nullptr;
+		}
+	};
+
+	/* map a pool at addr, failing instead of replacing host mappings of the emulator */
+	inline void* abi_hle_map_pool(addr_t addr, size_t len)
+	{
+		void *ptr = mmap((void*)addr, len, PROT_READ | PROT_WRITE,
+			MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
+		if (ptr == MAP_FAILED) return nullptr;
+		if (ptr != (void*)addr) {
+			munmap(ptr, len);
+			return nullptr;
+		}
+		return ptr;
+	}
+
+	/*
+	 * create the malloc pool at the base of the guest heap and move the break
+	 * above it, or below the lowest guest mapping if the host uses that range
+	 */
+	template <typename P>
+	bool abi_hle_heap_init(P &proc, size_t chunk)
+	{
+		hle_table &hle = *proc.hle;
+		addr_t base = round_up(proc.mmu.heap_end, page_size);
+		void *addr = proc.mmu.regions.is_free(base, base + chunk) ? abi_hle_map_pool(base, chunk) : nullptr;
+		if (addr) {
+			proc.mmu.heap_begin = proc.mmu.heap_end = base + chunk;
+		} else {
+			base = proc.mmu.regions.find_free(base, proc.mmu.mmap_top, chunk);
+			addr = base ? abi_hle_map_pool(base, chunk) : nullptr;
+			if (!addr) return false;
+		}
+		proc.mmu.regions.add(base, base + chunk, PROT_READ | PROT_WRITE);
+		hle.heap = tlsf_create_with_pool(addr, chunk);
+		hle.heap_chunk = chunk;
+		return hle.heap != nullptr;
+	}
+
+	/* add a pool below the lowest guest mapping when the heap is exhausted */
+	template <typename P>
+	bool abi_hle_heap_grow(P &proc, size_t size)
+	{
+		hle_table &hle = *proc.hle;
+		size_t len = round_up(std::max(size + (size >> 1), hle.heap_chunk), page_size);
+		len = std::min(len, tlsf_block_size_max());
+		addr_t floor = round_up(proc.mmu.heap_end, page_size);
+		addr_t addr = proc.mmu.regions.find_free(floor, proc.mmu.mmap_top, len);
+		if (!addr || !abi_hle_map_pool(addr, len)) return false;
+		proc.mmu.regions.add(addr, addr + len, PROT_READ | PROT_WRITE);
+		return tlsf_add_pool(hle.heap, (void*)addr, len) != nullptr;
+	}
+
+	/* allocations are aligned to at least two words like the guest malloc */
+	template <typename P>
+	void* abi_hle_heap_alloc(P &proc, size_t size, size_t align = 0)
+	{
+		hle_table &hle = *proc.hle;
+		align = std::max(align, sizeof(typename P::ux) * 2);
+		if (align & (align - 1)) return nullptr;
+		void *ptr = tlsf_memalign(hle.heap, align, size);
+		if (!ptr && abi_hle_heap_grow(proc, size + align + tlsf_pool_overhead())) {
+			ptr = tlsf_memalign(hle.heap, align, size);
+		}
+		return ptr;
+	}
+
+	template <typename P>
+	void* abi_hle_heap_realloc(P &proc, void *ptr, size_t size)
+	{
+		hle_table &hle = *proc.hle;
+		if (!ptr) return abi_hle_heap_alloc(proc, size);
+		if (size == 0) {
+			tlsf_free(hle.heap, ptr);
+			return nullptr;
+		}
+		size_t old_size = tlsf_block_size(ptr);
+		if (old_size >= size) return ptr;
+		void *new_ptr = abi_hle_heap_alloc(proc, size);
+		if (new_ptr) {
+			memcpy(new_ptr, ptr, old_size);
+			tlsf_free(hle.heap, ptr);
+		}
+		return new_ptr;
+	}
+
+	/* run the host routine on guest memory, returns a0 */
+	template <typename P>
+	typename P::ux abi_hle_exec(P &proc, hle_fn fn)
+	{
+		typedef typename P::ux ux;
+		ux a0 = proc.ireg[riscv_ireg_a0], a1 = proc.ireg[riscv_ireg_a1], a2 = proc.ireg[riscv_ireg_a2];
+
+		/* the reentrant entry points take the newlib reent pointer first */
+		switch (fn) {
+			case hle_fn_malloc_r:  fn = hle_fn_malloc;  a0 = a1; break;
+			case hle_fn_free_r:    fn = hle_fn_free;    a0 = a1; break;
+			case hle_fn_calloc_r:  fn = hle_fn_calloc;  a0 = a1; a1 = a2; break;
+			case hle_fn_realloc_r: fn = hle_fn_realloc; a0 = a1; a1 = a2; break;
+			case hle_fn_memalign_r: fn = hle_fn_memalign; a0 = a1; a1 = a2; break;
+			case hle_fn_valloc_r:  fn = hle_fn_valloc;  a0 = a1; break;
+			case hle_fn_pvalloc_r: fn = hle_fn_pvalloc; a0 = a1; break;
+			case hle_fn_malloc_usable_size_r: fn = hle_fn_malloc_usable_size; a0 = a1; break;
+			default: break;
+		}
+
+		switch (fn) {
+			case hle_fn_memcpy:
+				memcpy((void*)addr_t(a0), (const void*)addr_t(a1), size_t(a2));
+				return a0;
+			case hle_fn_memmove:
+				memmove((void*)addr_t(a0), (const void*)addr_t(a1), size_t(a2));
+				return a0;
+			case hle_fn_memset:
+				memset((void*)addr_t(a0), int(a1), size_t(a2));
+				return a0;
+			case hle_fn_memcmp:
+				return ux(memcmp((const void*)addr_t(a0), (const void*)addr_t(a1), size_t(a2)));
+			case hle_fn_strlen:
+				return ux(strlen((const char*)addr_t(a0)));
+			case hle_fn_strcmp:
+				return ux(strcmp((const char*)addr_t(a0), (const char*)addr_t(a1)));
+			case hle_fn_malloc:
+				return ux(addr_t(abi_hle_heap_alloc(proc, size_t(a0))));
+			case hle_fn_free:
+				if (a0) tlsf_free(proc.hle->heap, (void*)addr_t(a0));
+				return 0;
+			case hle_fn_calloc: {
+				if (a1 && size_t(a0) > std::numeric_limits<ux>::max() / size_t(a1)) return 0;
+				size_t size = size_t(a0) * size_t(a1);
+				void *ptr = abi_hle_heap_alloc(proc, size);
+				if (ptr) memset(ptr, 0, size);
+				return ux(addr_t(ptr));
+			}
+			case hle_fn_realloc:
+				return ux(addr_t(abi_hle_heap_realloc(proc, (void*)addr_t(a0), size_t(a1))));
+			case hle_fn_memalign:
+			case hle_fn_aligned_alloc:
+				return ux(addr_t(abi_hle_heap_alloc(proc, size_t(a1), size_t(a0))));
+			case hle_fn_posix_memalign: {
+				if (a1 == 0 || (a1 & (a1 - 1)) || a1 % sizeof(ux)) return EINVAL;
+				void *ptr = abi_hle_heap_alloc(proc, size_t(a2), size_t(a1));
+				if (!ptr) return ENOMEM;
+				*(ux*)addr_t(a0) = ux(addr_t(ptr));
+				return 0;
+			}
+			case hle_fn_valloc:
+				return ux(addr_t(abi_hle_heap_alloc(proc, size_t(a0), page_size)));
+			case hle_fn_pvalloc:
+				return ux(addr_t(abi_hle_heap_alloc(proc, round_up(size_t(a0), page_size), page_size)));
+			case hle_fn_malloc_usable_size:
+				return a0 ? ux(tlsf_block_size((void*)addr_t(a0))) : 0;
+			default:
+				return 0;
+		}
+	}
+
+	/* compute the host result into a verify frame without writing guest memory */
+	template <typename P>
+	void abi_hle_expect(P &proc, hle_verify_frame &f)
+	{
+		typedef typename P::ux ux;
+		ux a0 = proc.ireg[riscv_ireg_a0], a1 = proc.ireg[riscv_ireg_a1], a2 = proc.ireg[riscv_ireg_a2];
+		f.dst = addr_t(a0);
+		switch (f.ent->fn) {
+			case hle_fn_memcpy:
+			case hle_fn_memmove:
+				f.expect.assign((const u8*)addr_t(a1), (const u8*)addr_t(a1) + size_t(a2));
+				f.result = a0;
+				break;
+			case hle_fn_memset:
+				f.expect.assign(size_t(a2), u8(a1));
+				f.result = a0;
+				break;
+			default:
+				f.result = abi_hle_exec(proc, f.ent->fn);
+				break;
+		}
+	}
+
+	template <typename P>
+	addr_t abi_hle_verify_return(P &proc)
+	{
+		typedef typename P::ux ux;
+		hle_table &hle = *proc.hle;
+		if (hle.frames.empty()) {
+			panic("hle: return trap without a call");
+		}
+		hle_verify_frame f = std::move(hle.frames.back());
+		hle.frames.pop_back();
+
+		/* comparisons only need to agree on the sign */
+		ux a0 = proc.ireg[riscv_ireg_a0];
+		bool ok;
+		switch (f.ent->fn) {
+			case hle_fn_memcmp:
+			case hle_fn_strcmp: {
+				s32 x = s32(a0), y = s32(f.result);
+				ok = (x > 0) == (y > 0) && (x < 0) == (y < 0);
+				break;
+			}
+			default:
+				ok = a0 == ux(f.result);
+				break;
+		}
+		bool mem_ok = f.expect.size() == 0 ||
+			memcmp((const void*)f.dst, f.expect.data(), f.expect.size()) == 0;
+		hle.verify_count++;
+		if (!ok || !mem_ok) {
+			hle.mismatch_count++;
+			debug("hle: verify: %s: result 0x%llx expected 0x%llx%s", hle_fn_name(f.ent->fn),
+				(unsigned long long)a0, (unsigned long long)ux(f.result),
+				mem_ok ? "" : ", memory differs");
+		}
+		return f.ra - proc.pc;
+	}
+
+	/* handle an illegal instruction, returns the pc offset or 0 if it is not an HLE trap */
+	template <typename P>
+	addr_t abi_hle_trap(P &proc)
+	{
+		hle_table &hle = *proc.hle;
+		addr_t pc = proc.pc;
+		if (pc == hle.ret_trap) return abi_hle_verify_return(proc);
+		hle_entry *ent = hle.lookup(pc);
+		if (!ent) return 0;
+		ent->calls++;
+		if (!hle.verify || hle_fn_is_alloc(ent->fn)) {
+			proc.ireg[riscv_ireg_a0] = abi_hle_exec(proc, ent->fn);
+			return addr_t(proc.ireg[riscv_ireg_ra]) - pc;
+		}
+
+		/* interpret the guest routine and check it at the return trap */
+		hle_verify_frame f;
+		f.ent = ent;
+		f.ra = addr_t(proc.ireg[riscv_ireg_ra]);
+		abi_hle_expect(proc, f);
+		hle.frames.push_back(std::move(f));
+		proc.ireg[riscv_ireg_ra] = hle.ret_trap;
+		typename P::decode_type dec;
+		proc.inst_decode(dec, ent->orig_inst);
+		proc.inst_canonicalize(dec);
+		addr_t new_offset = proc.inst_exec(dec, ent->orig_len);
+		return new_offset ? new_offset : proc.inst_priv(dec, ent->orig_len);
+	}
+
+}
+
+#endif
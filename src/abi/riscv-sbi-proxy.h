@@ -0,0 +1,194 @@
+//
+//  riscv-sbi-proxy.h
+//
+
+#ifndef riscv_sbi_proxy_h
+#define riscv_sbi_proxy_h
+
+namespace riscv {
+
+	/*
+	 * Supervisor Binary Interface host implementation
+	 *
+	 * S-mode ecalls are serviced directly in the emulator instead of
+	 * trapping to emulated M-mode firmware. The call number is passed
+	 * in a7 using the legacy SBI v0.1 numbering, plus the BBL call that
+	 * returns the config string. Arguments are passed in a0-a3 and the
+	 * result is returned in a0 for every call that returns.
+	 */
+
+	enum sbi_call
+	{
+		sbi_call_set_timer = 0,
+		sbi_call_console_putchar = 1,
+		sbi_call_console_getchar = 2,
+		sbi_call_clear_ipi = 3,
+		sbi_call_send_ipi = 4,
+		sbi_call_remote_fence_i = 5,
+		sbi_call_remote_sfence_vma = 6,
+		sbi_call_remote_sfence_vma_asid = 7,
+		sbi_call_shutdown = 8,
+		sbi_call_config_string = 10,       /* BBL: physical address of the config string */
+	};
+
+	/* translate a supervisor virtual address to a host pointer, checking PMP read access */
+	template <typename P> void* sbi_guest_ptr(P &proc, typename P::ux va, size_t len)
+	{
+		intptr_t uva = proc.mmu.access_uva(proc, va, len, pmp_cfg_R, true);
+		return uva == -1 ? nullptr : (void*)uva;
+	}
+
+	/* read the hart mask, a null pointer selects all harts */
+	template <typename P> bool sbi_hart_mask(P &proc, typename P::ux harts, u64 &mask)
+	{
+		if (harts == 0) {
+			mask = ~0ULL;
+			return true;
+		}
+		typename P::ux *ptr = (typename P::ux*)sbi_guest_ptr(proc, harts, sizeof(typename P::ux));
+		if (!ptr) return false;
+		mask = u64(*ptr);
+		return true;
+	}
+
+	/* platform config string in the riscv-pk format, describing one hart and its RAM */
+	template <typename P> std::string sbi_config_string(P &proc, u64 ram_base, u64 ram_size)
+	{
+		static const char *canonical_order = "imafdqlcbjtpvneghkorsuwxyz";
+		std::string isa = format_string("rv%d", int(P::xlen));
+		for (const char *c = canonical_order; *c; c++) {
+			if (u64(proc.misa_default) & (1ULL << (*c - 'a'))) isa += *c;
+		}
+		return format_string(
+			"platform {\n  vendor riscv-meta;\n  arch emulator;\n};\n"
+			"ram {\n  0 {\n    addr 0x%llx;\n    size 0x%llx;\n  };\n};\n"
+			"core {\n  0 {\n    0 {\n      isa %s;\n    };\n  };\n};\n",
+			(unsigned long long)ram_base, (unsigned long long)ram_size, isa.c_str());
+	}
+
+	/* copy the config string to physical address pa for sbi_get_config */
+	template <typename P> bool sbi_install_config(P &proc, u64 pa, u64 ram_base, u64 ram_size)
+	{
+		std::string config = sbi_config_string(proc, ram_base, ram_size);
+		intptr_t uva = proc.mmu.mem.mpa_to_uva(pa);
+		if (uva == -1 || proc.mmu.mem.mpa_to_uva(pa + config.size()) != uva + intptr_t(config.size())) return false;
+		memcpy((void*)uva, config.c_str(), config.size() + 1);
+		proc.sbi_config = typename P::ux(pa);
+		return true;
+	}
+
+	template <typename P> void sbi_get_config(P &proc)
+	{
+		proc.ireg[riscv_ireg_a0] = proc.sbi_config;
+	}
+
+	/* program the supervisor timer, RV32 passes the 64-bit time in a0 and a1 */
+	template <typename P> void sbi_set_timer(P &proc)
+	{
+		u64 stime = P::xlen == 32 ?
+			(u64(u32(proc.ireg[riscv_ireg_a1].r.xu.val)) << 32) | u32(proc.ireg[riscv_ireg_a0].r.xu.val) :
+			u64(proc.ireg[riscv_ireg_a0].r.xu.val);
+		proc.mtimecmp = stime;
+		proc.mip.ip.stip = 0;
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	template <typename P> void sbi_console_putchar(P &proc)
+	{
+		proc.console.putchar(u8(proc.ireg[riscv_ireg_a0]));
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	template <typename P> void sbi_console_getchar(P &proc)
+	{
+		proc.ireg[riscv_ireg_a0] = proc.console_input.getchar();
+	}
+
+	/* clear the pending software interrupt, returning whether one was pending */
+	template <typename P> void sbi_clear_ipi(P &proc)
+	{
+		proc.ireg[riscv_ireg_a0] = proc.mip.ip.ssip;
+		proc.mip.ip.ssip = 0;
+	}
+
+	/* raise a supervisor software interrupt on the harts in the mask */
+	template <typename P> void sbi_send_ipi(P &proc)
+	{
+		u64 mask;
+		if (!sbi_hart_mask(proc, proc.ireg[riscv_ireg_a0], mask)) {
+			proc.ireg[riscv_ireg_a0] = -1;
+			return;
+		}
+		if (proc.mhartid < 64 && (mask & (1ULL << proc.mhartid))) {
+			proc.mip.ip.ssip = 1;
+		}
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	template <typename P> void sbi_remote_fence_i(P &proc)
+	{
+		u64 mask;
+		if (!sbi_hart_mask(proc, proc.ireg[riscv_ireg_a0], mask)) {
+			proc.ireg[riscv_ireg_a0] = -1;
+			return;
+		}
+		if (proc.shootdown_domain) {
+			proc.shootdown_domain->remote_fence_i(mask);
+		}
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	/* a range in every address space, which the TLB can only drop with a full flush */
+	template <typename P> void sbi_remote_sfence_vma(P &proc)
+	{
+		u64 mask;
+		if (!sbi_hart_mask(proc, proc.ireg[riscv_ireg_a0], mask)) {
+			proc.ireg[riscv_ireg_a0] = -1;
+			return;
+		}
+		if (proc.shootdown_domain) {
+			proc.shootdown_domain->remote_sfence_vm_all(mask);
+		}
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	template <typename P> void sbi_remote_sfence_vma_asid(P &proc)
+	{
+		u64 mask;
+		if (!sbi_hart_mask(proc, proc.ireg[riscv_ireg_a0], mask)) {
+			proc.ireg[riscv_ireg_a0] = -1;
+			return;
+		}
+		if (proc.shootdown_domain) {
+			proc.shootdown_domain->remote_sfence_vm_range(mask, proc.ireg[riscv_ireg_a3],
+				proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2]);
+		}
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	template <typename P> void sbi_shutdown(P &proc)
+	{
+		proc.console.flush();
+		exit(0);
+	}
+
+	template <typename P> void proxy_sbi(P &proc)
+	{
+		switch (proc.ireg[riscv_ireg_a7]) {
+			case sbi_call_set_timer:              sbi_set_timer(proc); break;
+			case sbi_call_console_putchar:        sbi_console_putchar(proc); break;
+			case sbi_call_console_getchar:        sbi_console_getchar(proc); break;
+			case sbi_call_clear_ipi:              sbi_clear_ipi(proc); break;
+			case sbi_call_send_ipi:               sbi_send_ipi(proc); break;
+			case sbi_call_remote_fence_i:         sbi_remote_fence_i(proc); break;
+			case sbi_call_remote_sfence_vma:      sbi_remote_sfence_vma(proc); break;
+			case sbi_call_remote_sfence_vma_asid: sbi_remote_sfence_vma_asid(proc); break;
+			case sbi_call_shutdown:               sbi_shutdown(proc); break;
+			case sbi_call_config_string:          sbi_get_config(proc); break;
+			default: panic("unknown sbi call: %d", proc.ireg[riscv_ireg_a7]);
+		}
+	}
+
+}
+
+#endif
@@ -0,0 +1,138 @@
+//
+//  riscv-syscall-log.h
+//
+
+#ifndef riscv_syscall_log_h
+#define riscv_syscall_log_h
+
+namespace riscv {
+
+	/*
+	 * syscall_log
+	 *
+	 * binary log of proxied syscalls used to record and replay guest runs
+	 *
+	 *   header  : magic "RVSL", version, initial register seed
+	 *   record  : syscall number, memory output count, a0-a5, result
+	 *   output  : guest address, length, bytes written to guest memory
+	 *
+	 * Records are written in syscall order and replay checks that the
+	 * guest makes the same sequence of syscalls with the same arguments.
+	 */
+
+	enum syscall_log_mode
+	{
+		syscall_log_mode_none,
+		syscall_log_mode_record,
+		syscall_log_mode_replay
+	};
+
+	struct syscall_log_header
+	{
+		char magic[4];
+		u32  version;
+		u64  seed;
+	};
+
+	struct syscall_log_record
+	{
+		u32 number;
+		u32 mem_count;
+		u64 args[6];
+		s64 result;
+	};
+
+	struct syscall_log_mem
+	{
+		u64 addr;
+		u64 len;
+	};
+
+	struct syscall_log
+	{
+		enum { version = 2 };
+
+		FILE *file;
+		syscall_log_mode mode;
+		u64 seed;                            /* initial register seed */
+		u64 count;                           /* records written or read */
+		std::vector<syscall_log_mem> mem;    /* outputs of the record being written */
+
+		syscall_log() : file(nullptr), mode(syscall_log_mode_none), seed(0), count(0) {}
+		syscall_log(const syscall_log&) = delete;
+		~syscall_log() { if (file) fclose(file); }
+
+		void open_record(const char *filename, u64 seed)
+		{
+			if (!(file = fopen(filename, "wb"))) {
+				panic("syscall_log: error: fopen: %s: %s", filename, strerror(errno));
+			}
+			syscall_log_header hdr = { { 'R', 'V', 'S', 'L' }, version, seed };
+			fwrite(&hdr, sizeof(hdr), 1, file);
+			mode = syscall_log_mode_record;
+			this->seed = seed;
+		}
+
+		void open_replay(const char *filename)
+		{
+			syscall_log_header hdr;
+			if (!(file = fopen(filename, "rb"))) {
+				panic("syscall_log: error: fopen: %s: %s", filename, strerror(errno));
+			}
+			if (fread(&hdr, sizeof(hdr), 1, file) != 1 || memcmp(hdr.magic, "RVSL", 4) != 0 ||
+				hdr.version != version)
+			{
+				panic("syscall_log: error: %s: not a version %d syscall log", filename, version);
+			}
+			mode = syscall_log_mode_replay;
+			seed = hdr.seed;
+		}
+
+		void flush() { if (file) fflush(file); }
+
+		/* note guest memory written by the syscall being recorded */
+		void add_mem(addr_t addr, size_t len)
+		{
+			if (addr && len) mem.push_back(syscall_log_mem{ u64(addr), u64(len) });
+		}
+
+		/* write the record and the current contents of its memory outputs */
+		void write(u32 number, const u64 *args, s64 result)
+		{
+			syscall_log_record rec = { number, u32(mem.size()), {}, result };
+			std::copy(args, args + 6, rec.args);
+			fwrite(&rec, sizeof(rec), 1, file);
+			for (auto &m : mem) {
+				fwrite(&m, sizeof(m), 1, file);
+				fwrite((const void*)addr_t(m.addr), 1, m.len, file);
+			}
+			mem.clear();
+			count++;
+		}
+
+		void read(syscall_log_record &rec)
+		{
+			if (fread(&rec, sizeof(rec), 1, file) != 1) {
+				panic("syscall_log: error: log exhausted after %" PRIu64 " records", count);
+			}
+			count++;
+		}
+
+		void read_mem(syscall_log_mem &m)
+		{
+			if (fread(&m, sizeof(m), 1, file) != 1) {
+				panic("syscall_log: error: truncated record %" PRIu64, count);
+			}
+		}
+
+		void read_bytes(void *dst, size_t len)
+		{
+			if (fread(dst, 1, len, file) != len) {
+				panic("syscall_log: error: truncated record %" PRIu64, count);
+			}
+		}
+	};
+
+}
+
+#endif
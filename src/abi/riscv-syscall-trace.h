@@ -0,0 +1,176 @@
+//
+//  riscv-syscall-trace.h
+//
+
+#ifndef riscv_syscall_trace_h
+#define riscv_syscall_trace_h
+
+namespace riscv {
+
+	/*
+	 * binary syscall trace
+	 *
+	 *   header  : magic "RVST", version, record size, tick scale
+	 *   record  : fixed size syscall_trace_record
+	 *
+	 * Times are host cycle counter ticks, the header holds nanoseconds
+	 * per tick in 32.32 fixed point for the decoder.
+	 */
+
+	struct syscall_trace_header
+	{
+		char magic[4];
+		u32  version;
+		u32  record_size;
+		u32  reserved;
+		u64  tick_scale;
+	};
+
+	struct syscall_trace_record
+	{
+		u64 start;                           /* cpu_cycle_clock at the ecall */
+		u64 duration;                        /* ticks until the result was available */
+		u64 args[6];                         /* a0-a5 */
+		s64 result;                          /* a0 on return */
+		u32 number;                          /* a7 */
+		u32 hart_id;
+	};
+
+
+	/*
+	 * syscall_trace_file
+	 *
+	 * trace output shared by the per-hart trace rings
+	 */
+
+	struct syscall_trace_file
+	{
+		enum { version = 1 };
+
+		int fd;
+		std::mutex lock;
+
+		syscall_trace_file(const char *filename, u64 tick_scale)
+		{
+			if ((fd = ::open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+				panic("syscall_trace: error: open: %s: %s", filename, strerror(errno));
+			}
+			syscall_trace_header hdr = { { 'R', 'V', 'S', 'T' }, version,
+				u32(sizeof(syscall_trace_record)), 0, tick_scale };
+			console_write_fd(fd, (const char*)&hdr, sizeof(hdr));
+		}
+
+		~syscall_trace_file() { ::close(fd); }
+
+		void write(const syscall_trace_record *recs, size_t count)
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			console_write_fd(fd, (const char*)recs, count * sizeof(syscall_trace_record));
+		}
+	};
+
+
+	/*
+	 * syscall_trace
+	 *
+	 * per-hart single producer, single consumer ring of trace records
+	 *
+	 * The hart appends a record per syscall without locking and a
+	 * background thread writes batches to the trace file when the ring
+	 * is half full or after flush_deadline_ms. A full ring drops records
+	 * rather than stall the hart; drops are counted.
+	 */
+
+	template <const size_t ring_size = 4096, const int flush_deadline_ms = 100>
+	struct syscall_trace
+	{
+		static_assert(ispow2(ring_size), "ring_size must be a power of 2");
+
+		syscall_trace_file &file;
+		u32 hart_id;
+		syscall_trace_record ring[ring_size];
+		std::atomic<size_t> head;            /* consumer position */
+		std::atomic<size_t> tail;            /* producer position */
+		std::atomic<bool> running;
+		std::mutex lock;
+		std::condition_variable wakeup;
+		std::condition_variable drained;
+		std::thread writer;
+
+		/* statistics */
+		std::atomic<u64> record_count;       /* records written */
+		std::atomic<u64> drop_count;         /* records dropped on a full ring */
+
+		syscall_trace(syscall_trace_file &file, u32 hart_id) :
+			file(file), hart_id(hart_id), head(0), tail(0), running(true),
+			record_count(0), drop_count(0)
+		{
+			writer = std::thread(&syscall_trace::writer_thread, this);
+		}
+
+		~syscall_trace()
+		{
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				running = false;
+			}
+			wakeup.notify_one();
+			writer.join();
+		}
+
+		void append(const syscall_trace_record &rec)
+		{
+			size_t t = tail.load(std::memory_order_relaxed);
+			size_t used = t - head.load(std::memory_order_acquire);
+			if (used == ring_size) {
+				drop_count.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			ring[t & (ring_size - 1)] = rec;
+			ring[t & (ring_size - 1)].hart_id = hart_id;
+			tail.store(t + 1, std::memory_order_release);
+			if (used + 1 == ring_size / 2) wakeup.notify_one();
+		}
+
+		/* block until all pending records have been written */
+		void flush()
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			wakeup.notify_one();
+			drained.wait(guard, [&] { return head.load() == tail.load(); });
+		}
+
+	private:
+		void write_pending()
+		{
+			size_t h = head.load(std::memory_order_relaxed);
+			size_t t = tail.load(std::memory_order_acquire);
+			while (h != t) {
+				/* write up to the end of the ring, then wrap */
+				size_t off = h & (ring_size - 1);
+				size_t count = std::min(t - h, ring_size - off);
+				file.write(ring + off, count);
+				record_count += count;
+				h += count;
+			}
+			head.store(h, std::memory_order_release);
+		}
+
+		void writer_thread()
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			while (running) {
+				wakeup.wait_for(guard, std::chrono::milliseconds(flush_deadline_ms));
+				guard.unlock();
+				write_pending();
+				guard.lock();
+				drained.notify_all();
+			}
+			guard.unlock();
+			write_pending();
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,122 @@
+//
+//  riscv-time-page.h
+//
+
+#ifndef riscv_time_page_h
+#define riscv_time_page_h
+
+namespace riscv {
+
+	/* guest clock identifiers (Linux generic values) */
+
+	enum abi_clockid
+	{
+		abi_clock_realtime = 0,
+		abi_clock_monotonic = 1,
+		abi_clock_process_cputime_id = 2,
+		abi_clock_thread_cputime_id = 3,
+		abi_clock_monotonic_raw = 4,
+		abi_clock_realtime_coarse = 5,
+		abi_clock_monotonic_coarse = 6,
+		abi_clock_boottime = 7,
+	};
+
+
+	/*
+	 * time_page
+	 *
+	 * vDSO style clock for the proxy ABI. The host cycle counter is
+	 * calibrated against the host clocks once at startup and guest time
+	 * requests are scaled in-process without a host syscall.
+	 *
+	 * In deterministic mode time is derived from instret with a fixed
+	 * number of nanoseconds per instruction, starting at the epoch, so
+	 * that runs are reproducible.
+	 */
+
+	struct time_page
+	{
+		enum : u64 {
+			calibrate_ns = 10000000,      /* calibration interval (10ms) */
+			ns_per_sec = 1000000000
+		};
+
+		bool valid;                       /* calibrated, otherwise use host calls */
+		bool deterministic;               /* ticks are instret */
+		u64  base_ticks;                  /* ticks at the base time */
+		s64  base_realtime;               /* CLOCK_REALTIME at base_ticks (ns) */
+		s64  base_monotonic;              /* CLOCK_MONOTONIC at base_ticks (ns) */
+		u64  scale;                       /* ns per tick in 32.32 fixed point */
+
+		time_page() : valid(false), deterministic(false), base_ticks(0),
+			base_realtime(0), base_monotonic(0), scale(0) {}
+
+		static s64 host_ns(clockid_t clk)
+		{
+			struct timespec ts;
+			clock_gettime(clk, &ts);
+			return s64(ts.tv_sec) * ns_per_sec + ts.tv_nsec;
+		}
+
+		/* measure the cycle counter rate against CLOCK_MONOTONIC */
+		void calibrate()
+		{
+			deterministic = false;
+			s64 r0 = host_ns(CLOCK_REALTIME), m0 = host_ns(CLOCK_MONOTONIC), m1;
+			u64 c0 = cpu_cycle_clock(), c1;
+			do {
+				c1 = cpu_cycle_clock();
+				m1 = host_ns(CLOCK_MONOTONIC);
+			} while (m1 - m0 < s64(calibrate_ns));
+			if (c1 <= c0) {
+				valid = false; /* no usable cycle counter */
+				return;
+			}
+			scale = (u64(m1 - m0) << 32) / (c1 - c0);
+			base_ticks = c1;
+			base_monotonic = m1;
+			base_realtime = r0 + (m1 - m0);
+			valid = true;
+		}
+
+		/* derive time from instret */
+		void calibrate_instret(u64 ns_per_inst)
+		{
+			deterministic = true;
+			scale = ns_per_inst << 32;
+			base_ticks = 0;
+			base_monotonic = 0;
+			base_realtime = 0;
+			valid = true;
+		}
+
+		/* returns true if the clock is served from the time page */
+		bool serves(int clk)
+		{
+			if (!valid) return false;
+			if (deterministic) return clk >= abi_clock_realtime && clk <= abi_clock_boottime;
+			switch (clk) {
+				case abi_clock_realtime:
+				case abi_clock_realtime_coarse:
+				case abi_clock_monotonic:
+				case abi_clock_monotonic_raw:
+				case abi_clock_monotonic_coarse:
+					return true;
+				default:
+					return false;
+			}
+		}
+
+		/* time in nanoseconds for a clock served from the time page */
+		s64 now_ns(int clk, u64 instret)
+		{
+			u64 d = (deterministic ? instret : cpu_cycle_clock()) - base_ticks;
+			s64 ns = s64((d >> 32) * scale + (((d & 0xffffffff) * scale) >> 32));
+			bool realtime = clk == abi_clock_realtime || clk == abi_clock_realtime_coarse;
+			return (realtime ? base_realtime : base_monotonic) + ns;
+		}
+	};
+
+}
+
+#endif
@@ -7,48 +7,327 @@
 
 namespace riscv {
 
+	/*
+	 * proxy_region
+	 *
+	 * page aligned guest mapping [begin, end) in the proxy address space
+	 */
+
+	struct proxy_region
+	{
+		addr_t begin;
+		addr_t end;
+		int prot;
+
+		proxy_region() : begin(0), end(0), prot(0) {}
+		proxy_region(addr_t begin, addr_t end, int prot) : begin(begin), end(end), prot(prot) {}
+	};
+
+
+	/*
+	 * proxy_region_map
+	 *
+	 * tracks the guest mappings so that guest munmap, mprotect and mremap
+	 * can only modify memory that was mapped for the guest, and so that
+	 * address space for non fixed mappings can be found without probing
+	 */
+
+	struct proxy_region_map
+	{
+		std::map<addr_t,proxy_region> regions; /* keyed by region end */
+		u64 generation;                        /* incremented on every change */
+
+		proxy_region_map() : generation(0) {}
+
+		/* add a region, replacing any overlapping regions */
+		void add(addr_t begin, addr_t end, int prot)
+		{
+			begin &= page_mask;
+			end = round_up(end, page_size);
+			remove(begin, end);
+			regions[end] = proxy_region(begin, end, prot);
+		}
+
+		/* remove [begin, end), splitting regions that straddle the bounds */
+		void remove(addr_t begin, addr_t end)
+		{
+			generation++;
+			auto i = regions.upper_bound(begin);
+			while (i != regions.end() && i->second.begin < end) {
+				proxy_region r = i->second;
+				i = regions.erase(i);
+				if (r.begin < begin) regions[begin] = proxy_region(r.begin, begin, r.prot);
+				if (r.end > end) {
+					regions[r.end] = proxy_region(end, r.end, r.prot);
+					break;
+				}
+			}
+		}
+
+		/* change protection of [begin, end) */
+		void protect(addr_t begin, addr_t end, int prot)
+		{
+			std::vector<proxy_region> changed;
+			for (auto i = regions.upper_bound(begin); i != regions.end() && i->second.begin < end; i++) {
+				changed.push_back(proxy_region(std::max(begin, i->second.begin),
+					std::min(end, i->second.end), prot));
+			}
+			for (auto &r : changed) add(r.begin, r.end, r.prot);
+			coalesce(begin & page_mask, round_up(end, page_size));
+		}
+
+		/* merge touching regions with the same protection in and around [begin, end) */
+		void coalesce(addr_t begin, addr_t end)
+		{
+			auto i = regions.lower_bound(begin);
+			while (i != regions.end()) {
+				auto next = std::next(i);
+				if (next == regions.end() || next->second.begin > end) break;
+				if (next->second.begin == i->second.end && next->second.prot == i->second.prot) {
+					next->second.begin = i->second.begin;
+					i = regions.erase(i);
+				} else {
+					i = next;
+				}
+			}
+		}
+
+		/* returns true if every page of [begin, end) is mapped */
+		bool contains(addr_t begin, addr_t end)
+		{
+			for (auto i = regions.upper_bound(begin); i != regions.end(); i++) {
+				if (i->second.begin > begin) return false;
+				if (i->second.end >= end) return true;
+				begin = i->second.end;
+			}
+			return false;
+		}
+
+		/* returns true if every page of [begin, end) is mapped with protection prot */
+		bool has_prot(addr_t begin, addr_t end, int prot)
+		{
+			for (auto i = regions.upper_bound(begin); i != regions.end(); i++) {
+				if (i->second.begin > begin || i->second.prot != prot) return false;
+				if (i->second.end >= end) return true;
+				begin = i->second.end;
+			}
+			return false;
+		}
+
+		/* returns true if no page of [begin, end) is mapped */
+		bool is_free(addr_t begin, addr_t end)
+		{
+			auto i = regions.upper_bound(begin);
+			return i == regions.end() || i->second.begin >= end;
+		}
+
+		/* find the highest free range of len bytes in [floor, ceiling), returns 0 if none */
+		addr_t find_free(addr_t floor, addr_t ceiling, size_t len)
+		{
+			addr_t top = ceiling;
+			auto i = regions.lower_bound(ceiling);
+			if (i != regions.end() && i->second.begin < top) top = i->second.begin;
+			while (i != regions.begin()) {
+				--i;
+				if (size_t(top - i->second.end) >= len) break;
+				top = i->second.begin;
+			}
+			return top >= floor + addr_t(len) ? top - addr_t(len) : 0;
+		}
+	};
+
+
 	template <typename UX>
 	struct mmu_proxy
 	{
-		std::vector<std::pair<void*,size_t>> segments;
+		proxy_region_map regions;
 		addr_t heap_begin;
 		addr_t heap_end;
+		addr_t mmap_top;
 
-		mmu_proxy() : segments(), heap_begin(0), heap_end(0) {}
+		mmu_proxy() : regions(), heap_begin(0), heap_end(0), mmap_top(0) {}
 
 		inst_t inst_fetch(UX pc, addr_t &pc_offset)
 		{
 			return riscv::inst_fetch(pc, pc_offset);
 		}
+
+		/* unmap all guest regions */
+		void unmap_all()
+		{
+			for (auto &ent : regions.regions) {
+				munmap((void*)ent.second.begin, ent.second.end - ent.second.begin);
+			}
+			regions.regions.clear();
+			regions.generation++;
+		}
 	};
 
 	using mmu_proxy_rv32 = mmu_proxy<u32>;
 	using mmu_proxy_rv64 = mmu_proxy<u64>;
 
-	enum abi_syscall
-	{
-		abi_syscall_close = 57,
-		abi_syscall_lseek = 62,
-		abi_syscall_read = 63,
-		abi_syscall_write = 64,
-		abi_syscall_pread = 67,
-		abi_syscall_pwrite = 68,
-		abi_syscall_fstat = 80,
-		abi_syscall_exit = 93,
-		abi_syscall_gettimeofday = 169,
-		abi_syscall_brk = 214,
+	/* guest mmap and mremap flags (Linux generic values) */
+
+	enum abi_mmap_flag
+	{
+		abi_map_shared = 0x01,
+		abi_map_private = 0x02,
+		abi_map_fixed = 0x10,
+		abi_map_anonymous = 0x20,
+		abi_map_noreserve = 0x4000,
+		abi_map_populate = 0x8000,
+		abi_map_fixed_noreplace = 0x100000,
+		abi_mremap_maymove = 1,
+		abi_mremap_fixed = 2,
+	};
+
+	inline int cvt_abi_mmap_flags(int flags)
+	{
+		int host_flags = 0;
+		if (flags & abi_map_shared) host_flags |= MAP_SHARED;
+		if (flags & abi_map_private) host_flags |= MAP_PRIVATE;
+		if (flags & abi_map_anonymous) host_flags |= MAP_ANONYMOUS;
+		if (flags & abi_map_noreserve) host_flags |= MAP_NORESERVE;
+	#if defined (MAP_POPULATE)
+		if (flags & abi_map_populate) host_flags |= MAP_POPULATE;
+	#endif
+		return host_flags;
+	}
+
+	/* initial process stack auxiliary vector entries (Linux generic values) */
+
+	enum abi_auxv_type
+	{
+		abi_at_null = 0,
+		abi_at_phdr = 3,
+		abi_at_phent = 4,
+		abi_at_phnum = 5,
+		abi_at_pagesz = 6,
+		abi_at_entry = 9,
+		abi_at_uid = 11,
+		abi_at_euid = 12,
+		abi_at_gid = 13,
+		abi_at_egid = 14,
+		abi_at_hwcap = 16,
+		abi_at_clktck = 17,
+		abi_at_secure = 23,
+		abi_at_random = 25,
+		abi_at_execfn = 31,
 	};
 
+	typedef std::vector<std::pair<u64,u64>> abi_auxv;
+
+	/*
+	 * Build the initial process stack below stack_top and point sp at argc
+	 *
+	 *   sp -> argc, argv[], NULL, envp[], NULL, auxv[], AT_NULL
+	 *         AT_RANDOM bytes, argument and environment strings
+	 *
+	 * AT_RANDOM and AT_EXECFN are appended to auxv. Returns false if the
+	 * arguments do not fit in stack_limit bytes.
+	 */
+	template <typename P>
+	bool abi_init_stack(P &proc, addr_t stack_top, size_t stack_limit,
+		const std::vector<std::string> &args, const std::vector<std::string> &env,
+		abi_auxv auxv, const u8 random[16])
+	{
+		typedef typename P::ux ux;
+
+		/* lay out strings in ascending order below a zero word at the top */
+		size_t strings_size = 0;
+		for (auto &s : args) strings_size += s.size() + 1;
+		for (auto &s : env) strings_size += s.size() + 1;
+		addr_t strings = stack_top - sizeof(u64) - strings_size;
+		addr_t rand = (strings - 16) & ~addr_t(15);
+		size_t words = 1 + (args.size() + 1) + (env.size() + 1) + (auxv.size() + 3) * 2;
+		addr_t sp = (rand - words * sizeof(ux)) & ~addr_t(15);
+		if (size_t(stack_top - sp) > stack_limit) return false;
+
+		std::vector<ux> argp, envp;
+		addr_t str = strings;
+		for (auto &s : args) {
+			memcpy((void*)str, s.c_str(), s.size() + 1);
+			argp.push_back(ux(str));
+			str += s.size() + 1;
+		}
+		for (auto &s : env) {
+			memcpy((void*)str, s.c_str(), s.size() + 1);
+			envp.push_back(ux(str));
+			str += s.size() + 1;
+		}
+		memset((void*)str, 0, stack_top - str);
+		memcpy((void*)rand, random, 16);
+
+		auxv.push_back(std::pair<u64,u64>(abi_at_random, rand));
+		auxv.push_back(std::pair<u64,u64>(abi_at_execfn, argp.size() > 0 ? argp[0] : 0));
+		auxv.push_back(std::pair<u64,u64>(abi_at_null, 0));
+
+		ux *p = (ux*)sp;
+		*p++ = ux(args.size());
+		for (auto a : argp) *p++ = a;
+		*p++ = 0;
+		for (auto e : envp) *p++ = e;
+		*p++ = 0;
+		for (auto &ent : auxv) {
+			*p++ = ux(ent.first);
+			*p++ = ux(ent.second);
+		}
+
+		/* a0 holds the dynamic linker fini function, there is none */
+		proc.ireg[riscv_ireg_sp] = sp;
+		proc.ireg[riscv_ireg_a0] = 0;
+		return true;
+	}
+
+	inline int cvt_abi_open_flags(int flags)
+	{
+		int host_flags = 0;
+		switch (flags & abi_o_accmode) {
+			case abi_o_wronly: host_flags |= O_WRONLY; break;
+			case abi_o_rdwr:   host_flags |= O_RDWR; break;
+			default:           host_flags |= O_RDONLY; break;
+		}
+		if (flags & abi_o_creat) host_flags |= O_CREAT;
+		if (flags & abi_o_excl) host_flags |= O_EXCL;
+		if (flags & abi_o_noctty) host_flags |= O_NOCTTY;
+		if (flags & abi_o_trunc) host_flags |= O_TRUNC;
+		if (flags & abi_o_append) host_flags |= O_APPEND;
+		if (flags & abi_o_nonblock) host_flags |= O_NONBLOCK;
+		if (flags & abi_o_dsync) host_flags |= O_DSYNC;
+		if (flags & abi_o_directory) host_flags |= O_DIRECTORY;
+		if (flags & abi_o_nofollow) host_flags |= O_NOFOLLOW;
+		return host_flags;
+	}
+
+	inline std::string abi_prot_name(int prot)
+	{
+		std::string s;
+		s += (prot & PROT_READ) ? "+R" : "-R";
+		s += (prot & PROT_WRITE) ? "+W" : "-W";
+		s += (prot & PROT_EXEC) ? "+X" : "-X";
+		return s;
+	}
+
 	template <typename P> struct abi_timeval {
 		typename P::long_t tv_sec;
 		typename P::long_t tv_usec;
 	};
 
+	template <typename P> struct abi_timespec {
+		typename P::long_t tv_sec;
+		typename P::long_t tv_nsec;
+	};
+
 	template <typename P> struct abi_timezone {
 		typename P::int_t tz_minuteswest;
 		typename P::int_t tz_dsttime;
 	};
 
+	template <typename P> struct abi_iovec {
+		typename P::ulong_t iov_base;
+		typename P::ulong_t iov_len;
+	};
+
 	template <typename P> struct abi_stat
 	{
 		typename P::ulong_t dev;
@@ -103,76 +382,354 @@ namespace riscv {
 	#endif
 	}
 
+	/*
+	 * abi_syscall_frame
+	 *
+	 * copy of the argument registers of a syscall that is run on an
+	 * offload thread. It provides the processor types used by the
+	 * abi_sys_* functions so they can be instantiated for a frame.
+	 */
+	template <typename P>
+	struct abi_syscall_frame
+	{
+		typedef typename P::long_t long_t;
+		typedef typename P::ulong_t ulong_t;
+		typedef typename P::int_t int_t;
+		typedef typename P::uint_t uint_t;
+		typedef typename std::remove_reference<decltype(std::declval<P&>().ireg[0])>::type ireg_t;
+
+		ireg_t ireg[P::ireg_count];
+	};
+
+	/* host fd for a guest fd, frames for offloaded syscalls hold host fds */
+	template <typename P> int abi_host_fd(P &proc, int fd)
+	{
+		return proc.fds.host_fd(fd);
+	}
+
+	template <typename P> int abi_host_fd(abi_syscall_frame<P> &frame, int fd)
+	{
+		return fd;
+	}
+
+	/* return the host result or -errno in a0 */
+	template <typename P> void abi_set_result(P &proc, ssize_t ret)
+	{
+		proc.ireg[riscv_ireg_a0] = ret < 0 ? -errno : ret;
+	}
+
 	template <typename P> void abi_sys_close(P &proc)
 	{
-		proc.ireg[riscv_ireg_a0] = close(proc.ireg[riscv_ireg_a0]);
+		proc.ireg[riscv_ireg_a0] = proc.fds.close(int(proc.ireg[riscv_ireg_a0]));
+	}
+
+	template <typename P> void abi_sys_openat(P &proc)
+	{
+		int dirfd = int(proc.ireg[riscv_ireg_a0]);
+		const char *path = (const char*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
+		int flags = int(proc.ireg[riscv_ireg_a2]);
+		int mode = int(proc.ireg[riscv_ireg_a3]);
+		int fd_flags = (flags & abi_o_cloexec) ? fd_table::fd_cloexec : 0;
+
+		// preloaded input files opened read-only are served from memory
+		if (proc.fds.preload && (flags & abi_o_accmode) == abi_o_rdonly &&
+			!(flags & (abi_o_creat | abi_o_trunc | abi_o_directory)) &&
+			(dirfd == abi_at_fdcwd || path[0] == '/'))
+		{
+			std::shared_ptr<fd_memfile> mf = proc.fds.preload->lookup(path);
+			if (mf) {
+				proc.ireg[riscv_ireg_a0] = proc.fds.install(std::make_shared<fd_file>(mf, flags), 0, fd_flags);
+				if (proc.flags & processor_flag_emulator_debug) {
+					debug("openat    : %s (preloaded) = %d", path, int(proc.ireg[riscv_ireg_a0]));
+				}
+				return;
+			}
+		}
+
+		// the host fd is close-on-exec as the emulator never hands it to a child
+		int host_dirfd = dirfd == abi_at_fdcwd ? AT_FDCWD : proc.fds.host_fd(dirfd);
+		int host_fd = openat(host_dirfd, path, cvt_abi_open_flags(flags) | O_CLOEXEC, mode);
+		if (host_fd < 0) {
+			proc.ireg[riscv_ireg_a0] = -errno;
+			return;
+		}
+		proc.ireg[riscv_ireg_a0] = proc.fds.install(std::make_shared<fd_file>(host_fd, true, flags), 0, fd_flags);
+		if (proc.flags & processor_flag_emulator_debug) {
+			debug("openat    : %s = %d", path, int(proc.ireg[riscv_ireg_a0]));
+		}
+	}
+
+	template <typename P> void abi_sys_dup(P &proc)
+	{
+		proc.ireg[riscv_ireg_a0] = proc.fds.dup(int(proc.ireg[riscv_ireg_a0]), 0, 0);
+	}
+
+	template <typename P> void abi_sys_dup3(P &proc)
+	{
+		int flags = int(proc.ireg[riscv_ireg_a2]);
+		if (flags & ~abi_o_cloexec) {
+			proc.ireg[riscv_ireg_a0] = -EINVAL;
+			return;
+		}
+		proc.ireg[riscv_ireg_a0] = proc.fds.dup3(int(proc.ireg[riscv_ireg_a0]),
+			int(proc.ireg[riscv_ireg_a1]), flags ? fd_table::fd_cloexec : 0);
+	}
+
+	template <typename P> void abi_sys_fcntl(P &proc)
+	{
+		int fd = int(proc.ireg[riscv_ireg_a0]);
+		int cmd = int(proc.ireg[riscv_ireg_a1]);
+		int arg = int(proc.ireg[riscv_ireg_a2]);
+		fd_file *f = proc.fds.get(fd);
+		if (!f) {
+			proc.ireg[riscv_ireg_a0] = -EBADF;
+			return;
+		}
+		switch (cmd) {
+			case abi_f_dupfd:
+				proc.ireg[riscv_ireg_a0] = proc.fds.dup(fd, arg, 0);
+				break;
+			case abi_f_dupfd_cloexec:
+				proc.ireg[riscv_ireg_a0] = proc.fds.dup(fd, arg, fd_table::fd_cloexec);
+				break;
+			case abi_f_getfd:
+				proc.ireg[riscv_ireg_a0] = proc.fds.get_fd_flags(fd);
+				break;
+			case abi_f_setfd:
+				proc.ireg[riscv_ireg_a0] = proc.fds.set_fd_flags(fd, arg);
+				break;
+			case abi_f_getfl:
+				proc.ireg[riscv_ireg_a0] = f->status_flags;
+				break;
+			case abi_f_setfl:
+			{
+				// only the append and non-blocking status flags can be changed
+				const int mask = abi_o_append | abi_o_nonblock;
+				int status_flags = (f->status_flags & ~mask) | (arg & mask);
+				if (f->host_fd >= 0 && fcntl(f->host_fd, F_SETFL, cvt_abi_open_flags(status_flags)) < 0) {
+					proc.ireg[riscv_ireg_a0] = -errno;
+					break;
+				}
+				f->status_flags = status_flags;
+				proc.ireg[riscv_ireg_a0] = 0;
+				break;
+			}
+			default:
+				proc.ireg[riscv_ireg_a0] = -EINVAL;
+				break;
+		}
 	}
 
 	template <typename P> void abi_sys_lseek(P &proc)
 	{
-		proc.ireg[riscv_ireg_a0] = lseek(proc.ireg[riscv_ireg_a0],
-			proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2]);
+		abi_set_result(proc, lseek(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])),
+			proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2]));
 	}
 
 	template <typename P> void abi_sys_read(P &proc)
 	{
-		proc.ireg[riscv_ireg_a0] = read(proc.ireg[riscv_ireg_a0],
-			(void*)(addr_t)proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2]);
+		abi_set_result(proc, read(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])),
+			(void*)(addr_t)proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2]));
 	}
 
 	template <typename P> void abi_sys_write(P &proc)
 	{
-		proc.ireg[riscv_ireg_a0] = write(proc.ireg[riscv_ireg_a0],
-			(void*)(addr_t)proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2]);
+		abi_set_result(proc, write(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])),
+			(void*)(addr_t)proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2]));
 	}
 
 	template <typename P> void abi_sys_pread(P &proc)
 	{
-		proc.ireg[riscv_ireg_a0] = pread(proc.ireg[riscv_ireg_a0],
+		abi_set_result(proc, pread(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])),
 			(void*)(addr_t)proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2],
-			proc.ireg[riscv_ireg_a3]);
+			proc.ireg[riscv_ireg_a3]));
 	}
 
 	template <typename P> void abi_sys_pwrite(P &proc)
 	{
-		proc.ireg[riscv_ireg_a0] = pwrite(proc.ireg[riscv_ireg_a0],
+		abi_set_result(proc, pwrite(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])),
 			(void*)(addr_t)proc.ireg[riscv_ireg_a1], proc.ireg[riscv_ireg_a2],
-			proc.ireg[riscv_ireg_a3]);
+			proc.ireg[riscv_ireg_a3]));
+	}
+
+	/*
+	 * guest iovec translation
+	 *
+	 * When the guest iovec has the host layout (RV64 on a 64-bit host) the
+	 * guest array is passed to the host in place, otherwise it is widened
+	 * into a host array. The buffers themselves are never copied.
+	 */
+	template <typename P>
+	struct abi_iovec_array
+	{
+		enum { iov_max = 1024 };
+
+		const struct iovec *iov;
+		int iovcnt;
+		struct iovec host_iov[sizeof(abi_iovec<P>) == sizeof(struct iovec) ? 1 : iov_max];
+
+		abi_iovec_array(addr_t guest_iov, int iovcnt) : iov(nullptr), iovcnt(iovcnt)
+		{
+			if (iovcnt < 0 || iovcnt > iov_max) return;
+			const abi_iovec<P> *giov = (const abi_iovec<P>*)guest_iov;
+			if (sizeof(abi_iovec<P>) == sizeof(struct iovec)) {
+				iov = (const struct iovec*)giov;
+			} else {
+				for (int i = 0; i < iovcnt; i++) {
+					host_iov[i].iov_base = (void*)addr_t(giov[i].iov_base);
+					host_iov[i].iov_len = giov[i].iov_len;
+				}
+				iov = host_iov;
+			}
+		}
+
+		bool valid() { return iov != nullptr; }
+	};
+
+	/* 64-bit file offset passed in a register pair on RV32 and a single register on RV64 */
+	template <typename P> off_t abi_offset(P &proc, int lo, int hi)
+	{
+		return sizeof(typename P::long_t) == 4 ?
+			off_t(u64(u32(proc.ireg[lo].r.xu.val)) | (u64(proc.ireg[hi].r.xu.val) << 32)) :
+			off_t(proc.ireg[lo].r.xu.val);
+	}
+
+	template <typename P> void abi_sys_readv(P &proc)
+	{
+		abi_iovec_array<P> v(proc.ireg[riscv_ireg_a1].r.xu.val, int(proc.ireg[riscv_ireg_a2]));
+		if (!v.valid()) { proc.ireg[riscv_ireg_a0] = -EINVAL; return; }
+		abi_set_result(proc, readv(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])), v.iov, v.iovcnt));
+	}
+
+	template <typename P> void abi_sys_writev(P &proc)
+	{
+		abi_iovec_array<P> v(proc.ireg[riscv_ireg_a1].r.xu.val, int(proc.ireg[riscv_ireg_a2]));
+		if (!v.valid()) { proc.ireg[riscv_ireg_a0] = -EINVAL; return; }
+		abi_set_result(proc, writev(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])), v.iov, v.iovcnt));
+	}
+
+	template <typename P> void abi_sys_preadv(P &proc)
+	{
+		abi_iovec_array<P> v(proc.ireg[riscv_ireg_a1].r.xu.val, int(proc.ireg[riscv_ireg_a2]));
+		if (!v.valid()) { proc.ireg[riscv_ireg_a0] = -EINVAL; return; }
+		abi_set_result(proc, preadv(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])), v.iov, v.iovcnt,
+			abi_offset(proc, riscv_ireg_a3, riscv_ireg_a4)));
+	}
+
+	template <typename P> void abi_sys_pwritev(P &proc)
+	{
+		abi_iovec_array<P> v(proc.ireg[riscv_ireg_a1].r.xu.val, int(proc.ireg[riscv_ireg_a2]));
+		if (!v.valid()) { proc.ireg[riscv_ireg_a0] = -EINVAL; return; }
+		abi_set_result(proc, pwritev(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])), v.iov, v.iovcnt,
+			abi_offset(proc, riscv_ireg_a3, riscv_ireg_a4)));
+	}
+
+	template <typename P> void abi_sys_sendfile(P &proc)
+	{
+	#if defined (__linux__)
+		/* guest off_t is XLEN wide, translate it through a host off_t */
+		typename P::long_t *guest_off = (typename P::long_t*)(addr_t)proc.ireg[riscv_ireg_a2].r.xu.val;
+		off_t off = guest_off ? *guest_off : 0;
+		ssize_t ret = sendfile(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])),
+			abi_host_fd(proc, int(proc.ireg[riscv_ireg_a1])),
+			guest_off ? &off : nullptr, proc.ireg[riscv_ireg_a3].r.xu.val);
+		if (ret >= 0 && guest_off) *guest_off = off;
+		abi_set_result(proc, ret);
+	#else
+		proc.ireg[riscv_ireg_a0] = -ENOSYS;
+	#endif
+	}
+
+	template <typename P> void abi_sys_copy_file_range(P &proc)
+	{
+	#if defined (__linux__)
+		/* guest loff_t is 64-bit on RV32 and RV64 so the offsets are used in place */
+		loff_t *off_in = (loff_t*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
+		loff_t *off_out = (loff_t*)(addr_t)proc.ireg[riscv_ireg_a3].r.xu.val;
+		abi_set_result(proc, copy_file_range(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])), off_in,
+			abi_host_fd(proc, int(proc.ireg[riscv_ireg_a2])), off_out, proc.ireg[riscv_ireg_a4].r.xu.val,
+			unsigned(proc.ireg[riscv_ireg_a5])));
+	#else
+		proc.ireg[riscv_ireg_a0] = -ENOSYS;
+	#endif
 	}
 
 	template <typename P> void abi_sys_fstat(P &proc)
 	{
 		struct stat host_stat;
 		memset(&host_stat, 0, sizeof(host_stat));
-		if ((proc.ireg[riscv_ireg_a0] = fstat(proc.ireg[riscv_ireg_a0], &host_stat)) == 0) {
+		int ret = fstat(abi_host_fd(proc, int(proc.ireg[riscv_ireg_a0])), &host_stat);
+		if (ret == 0) {
 			abi_stat<P> *guest_stat = (abi_stat<P>*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
 			cvt_abi_stat(guest_stat, &host_stat);
 		}
+		abi_set_result(proc, ret);
 	}
 
 	template <typename P> void abi_sys_exit(P &proc)
 	{
+		if (proc.hle) proc.hle->report();
 		exit(proc.ireg[riscv_ireg_a0]);
 	}
 
+	/* host clock for guest clocks that are not served from the time page */
+	inline bool abi_host_clock(int clk, clockid_t &host_clk)
+	{
+		switch (clk) {
+			case abi_clock_realtime:
+			case abi_clock_realtime_coarse:    host_clk = CLOCK_REALTIME; return true;
+			case abi_clock_monotonic:
+			case abi_clock_monotonic_raw:
+			case abi_clock_monotonic_coarse:   host_clk = CLOCK_MONOTONIC; return true;
+		#if defined (CLOCK_BOOTTIME)
+			case abi_clock_boottime:           host_clk = CLOCK_BOOTTIME; return true;
+		#else
+			case abi_clock_boottime:           host_clk = CLOCK_MONOTONIC; return true;
+		#endif
+			case abi_clock_process_cputime_id: host_clk = CLOCK_PROCESS_CPUTIME_ID; return true;
+			case abi_clock_thread_cputime_id:  host_clk = CLOCK_THREAD_CPUTIME_ID; return true;
+			default: return false;
+		}
+	}
+
+	template <typename P> void abi_sys_clock_gettime(P &proc)
+	{
+		int clk = int(proc.ireg[riscv_ireg_a0]);
+		abi_timespec<P> *guest_tp = (abi_timespec<P>*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
+		s64 ns;
+		clockid_t host_clk;
+		if (proc.clock.serves(clk)) {
+			ns = proc.clock.now_ns(clk, proc.instret);
+		} else if (abi_host_clock(clk, host_clk)) {
+			ns = time_page::host_ns(host_clk);
+		} else {
+			proc.ireg[riscv_ireg_a0] = -EINVAL;
+			return;
+		}
+		if (guest_tp) {
+			guest_tp->tv_sec = ns / time_page::ns_per_sec;
+			guest_tp->tv_nsec = ns % time_page::ns_per_sec;
+		}
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
 	template <typename P> void abi_sys_gettimeofday(P &proc)
 	{
-		struct timeval host_tp;
-		struct timezone host_tzp;
-		memset(&host_tp, 0, sizeof(host_tp));
-		memset(&host_tzp, 0, sizeof(host_tzp));
-		if ((proc.ireg[riscv_ireg_a0] = gettimeofday(&host_tp, &host_tzp)) == 0) {
-			if (proc.ireg[riscv_ireg_a0].r.xu.val != 0) {
-				abi_timeval<P> *guest_tp = (abi_timeval<P>*)(addr_t)proc.ireg[riscv_ireg_a0].r.xu.val;
-				guest_tp->tv_sec = host_tp.tv_sec;
-				guest_tp->tv_usec = host_tp.tv_usec;
-			}
-			if (proc.ireg[riscv_ireg_a1].r.xu.val != 0) {
-				abi_timezone<P> *guest_tzp = (abi_timezone<P>*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
-				guest_tzp->tz_minuteswest = host_tzp.tz_minuteswest;
-				guest_tzp->tz_dsttime = host_tzp.tz_dsttime;
-			}
+		abi_timeval<P> *guest_tp = (abi_timeval<P>*)(addr_t)proc.ireg[riscv_ireg_a0].r.xu.val;
+		abi_timezone<P> *guest_tzp = (abi_timezone<P>*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
+		if (guest_tp) {
+			s64 ns = proc.clock.serves(abi_clock_realtime) ?
+				proc.clock.now_ns(abi_clock_realtime, proc.instret) :
+				time_page::host_ns(CLOCK_REALTIME);
+			guest_tp->tv_sec = ns / time_page::ns_per_sec;
+			guest_tp->tv_usec = (ns % time_page::ns_per_sec) / 1000;
+		}
+		if (guest_tzp) {
+			/* the timezone is obsolete and is always UTC */
+			guest_tzp->tz_minuteswest = 0;
+			guest_tzp->tz_dsttime = 0;
 		}
+		proc.ireg[riscv_ireg_a0] = 0;
 	}
 
 	template <typename P> void abi_sys_brk(P &proc)
@@ -188,6 +745,12 @@ namespace riscv {
 			return;
 		}
 
+		// the heap can not grow into guest mmap regions
+		if (!proc.mmu.regions.is_free(curr_heap_end, new_heap_end)) {
+			proc.ireg[riscv_ireg_a0] = -ENOMEM;
+			return;
+		}
+
 		// map a new heap segment
 		void *addr = mmap((void*)curr_heap_end, new_heap_end - curr_heap_end,
 			PROT_READ | PROT_WRITE, MAP_FIXED | MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
@@ -196,7 +759,7 @@ namespace riscv {
 			proc.ireg[riscv_ireg_a0] = -ENOMEM;
 		} else {
 			// keep track of the mapped segment and set the new heap_end
-			proc.mmu.segments.push_back(std::pair<void*,size_t>((void*)curr_heap_end, new_heap_end - curr_heap_end));
+			proc.mmu.regions.add(curr_heap_end, new_heap_end, PROT_READ | PROT_WRITE);
 			proc.mmu.heap_end = new_heap_end;
 			if (proc.flags & processor_flag_emulator_debug) {
 				debug("mmap  brk : %016" PRIxPTR " - %016" PRIxPTR " +R+W",
@@ -206,23 +769,670 @@ namespace riscv {
 		}
 	}
 
-	template <typename P> void proxy_syscall(P &proc)
+	/*
+	 * guest mmap
+	 *
+	 * Guest and host addresses are identical in the proxy so file backed
+	 * mappings are made directly on the guest file descriptor and are
+	 * zero-copy. Mappings are confined to the guest area between the heap
+	 * and the bottom of the stack and are tracked in the region map.
+	 * host_fd backs file mappings in place of the guest fd in a4.
+	 */
+	template <typename P> void abi_mmap_host_fd(P &proc, int host_fd)
+	{
+		addr_t hint = proc.ireg[riscv_ireg_a0].r.xu.val;
+		addr_t len = round_up(addr_t(proc.ireg[riscv_ireg_a1].r.xu.val), page_size);
+		int prot = int(proc.ireg[riscv_ireg_a2]) & (PROT_READ | PROT_WRITE | PROT_EXEC);
+		int flags = int(proc.ireg[riscv_ireg_a3]);
+		int fd = int(proc.ireg[riscv_ireg_a4]);
+		off_t offset = off_t(proc.ireg[riscv_ireg_a5].r.xu.val);
+		int host_flags = cvt_abi_mmap_flags(flags);
+		bool fixed = flags & (abi_map_fixed | abi_map_fixed_noreplace);
+		addr_t addr;
+
+		if (len == 0 || (offset & ~page_mask) || (fixed && (hint & ~page_mask)) ||
+			!(host_flags & (MAP_SHARED | MAP_PRIVATE)))
+		{
+			proc.ireg[riscv_ireg_a0] = -EINVAL;
+			return;
+		}
+
+		if (fixed) {
+			// fixed mappings may only replace guest memory below the stack
+			if (hint < addr_t(page_size) || hint + len > proc.mmu.mmap_top || hint + len < hint) {
+				proc.ireg[riscv_ireg_a0] = -ENOMEM;
+				return;
+			}
+			if ((flags & abi_map_fixed_noreplace) && !proc.mmu.regions.is_free(hint, hint + len)) {
+				proc.ireg[riscv_ireg_a0] = -EEXIST;
+				return;
+			}
+			addr = hint;
+			host_flags |= MAP_FIXED;
+		} else {
+			// use the hint if it is free otherwise take the highest free range
+			hint &= page_mask;
+			addr_t floor = round_up(proc.mmu.heap_end, page_size);
+			if (hint >= floor && hint + len <= proc.mmu.mmap_top &&
+				proc.mmu.regions.is_free(hint, hint + len)) {
+				addr = hint;
+			} else if ((addr = proc.mmu.regions.find_free(floor, proc.mmu.mmap_top, len)) == 0) {
+				proc.ireg[riscv_ireg_a0] = -ENOMEM;
+				return;
+			}
+		}
+
+		void *host_addr = mmap((void*)addr, len, prot, host_flags, host_fd, offset);
+		if (host_addr == MAP_FAILED) {
+			proc.ireg[riscv_ireg_a0] = -errno;
+			return;
+		}
+
+		// without MAP_FIXED the host may ignore the address if it has its own mapping there
+		if (addr_t(host_addr) != addr) {
+			munmap(host_addr, len);
+			proc.ireg[riscv_ireg_a0] = -ENOMEM;
+			return;
+		}
+
+		proc.mmu.regions.add(addr, addr + len, prot);
+		if (proc.flags & processor_flag_emulator_debug) {
+			debug("mmap  map : %016" PRIxPTR " - %016" PRIxPTR " %s%s",
+				addr, addr + len, abi_prot_name(prot).c_str(),
+				(flags & abi_map_anonymous) ? "" : format_string(" fd=%d", fd).c_str());
+		}
+		proc.ireg[riscv_ireg_a0] = addr;
+	}
+
+	template <typename P> void abi_sys_mmap(P &proc)
+	{
+		int flags = int(proc.ireg[riscv_ireg_a3]);
+		abi_mmap_host_fd(proc, (flags & abi_map_anonymous) ? -1 : abi_host_fd(proc, int(proc.ireg[riscv_ireg_a4])));
+	}
+
+	template <typename P> void abi_sys_munmap(P &proc)
+	{
+		addr_t addr = proc.ireg[riscv_ireg_a0].r.xu.val;
+		addr_t len = round_up(addr_t(proc.ireg[riscv_ireg_a1].r.xu.val), page_size);
+
+		if ((addr & ~page_mask) || len == 0 || addr + len < addr) {
+			proc.ireg[riscv_ireg_a0] = -EINVAL;
+			return;
+		}
+
+		// only unmap the tracked parts of the range, the rest is not guest memory
+		auto &regions = proc.mmu.regions.regions;
+		for (auto i = regions.upper_bound(addr); i != regions.end() && i->second.begin < addr + len; i++) {
+			addr_t begin = std::max(addr, i->second.begin), end = std::min(addr + len, i->second.end);
+			munmap((void*)begin, end - begin);
+		}
+		proc.mmu.regions.remove(addr, addr + len);
+
+		if (proc.flags & processor_flag_emulator_debug) {
+			debug("munmap    : %016" PRIxPTR " - %016" PRIxPTR, addr, addr + len);
+		}
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	template <typename P> void abi_sys_mprotect(P &proc)
+	{
+		addr_t addr = proc.ireg[riscv_ireg_a0].r.xu.val;
+		addr_t len = round_up(addr_t(proc.ireg[riscv_ireg_a1].r.xu.val), page_size);
+		int prot = int(proc.ireg[riscv_ireg_a2]);
+
+		if ((addr & ~page_mask) || (prot & ~(PROT_READ | PROT_WRITE | PROT_EXEC))) {
+			proc.ireg[riscv_ireg_a0] = -EINVAL;
+			return;
+		}
+		if (!proc.mmu.regions.contains(addr, addr + len)) {
+			proc.ireg[riscv_ireg_a0] = -ENOMEM;
+			return;
+		}
+		if (len > 0 && mprotect((void*)addr, len, prot) < 0) {
+			proc.ireg[riscv_ireg_a0] = -errno;
+			return;
+		}
+		proc.mmu.regions.protect(addr, addr + len, prot);
+
+		if (proc.flags & processor_flag_emulator_debug) {
+			debug("mprotect  : %016" PRIxPTR " - %016" PRIxPTR " %s",
+				addr, addr + len, abi_prot_name(prot).c_str());
+		}
+		proc.ireg[riscv_ireg_a0] = 0;
+	}
+
+	template <typename P> void abi_sys_mremap(P &proc)
+	{
+	#if defined (__linux__)
+		addr_t old_addr = proc.ireg[riscv_ireg_a0].r.xu.val;
+		addr_t old_len = round_up(addr_t(proc.ireg[riscv_ireg_a1].r.xu.val), page_size);
+		addr_t new_len = round_up(addr_t(proc.ireg[riscv_ireg_a2].r.xu.val), page_size);
+		int flags = int(proc.ireg[riscv_ireg_a3]);
+		auto &regions = proc.mmu.regions;
+
+		if ((old_addr & ~page_mask) || new_len == 0 || (flags & abi_mremap_fixed) ||
+			(flags & ~(abi_mremap_maymove | abi_mremap_fixed)))
+		{
+			proc.ireg[riscv_ireg_a0] = -EINVAL;
+			return;
+		}
+		if (old_len == 0 || !regions.contains(old_addr, old_addr + old_len)) {
+			proc.ireg[riscv_ireg_a0] = -EFAULT;
+			return;
+		}
+
+		int prot = regions.regions.upper_bound(old_addr)->second.prot;
+		addr_t new_addr = old_addr;
+
+		if (new_len <= old_len) {
+			// shrink in place
+			if (new_len < old_len) munmap((void*)(old_addr + new_len), old_len - new_len);
+			regions.remove(old_addr + new_len, old_addr + old_len);
+		} else if (old_addr + new_len <= proc.mmu.mmap_top &&
+			regions.is_free(old_addr + old_len, old_addr + new_len))
+		{
+			// grow in place
+			void *host_addr = mremap((void*)old_addr, old_len, new_len, 0);
+			if (host_addr == MAP_FAILED) {
+				proc.ireg[riscv_ireg_a0] = -errno;
+				return;
+			}
+			regions.add(old_addr, old_addr + new_len, prot);
+		} else if (flags & abi_mremap_maymove) {
+			// move to the highest free range in the guest mmap area
+			addr_t floor = round_up(proc.mmu.heap_end, page_size);
+			if ((new_addr = regions.find_free(floor, proc.mmu.mmap_top, new_len)) == 0) {
+				proc.ireg[riscv_ireg_a0] = -ENOMEM;
+				return;
+			}
+			// reserve the target without MAP_FIXED so a host mapping there is not replaced
+			void *probe = mmap((void*)new_addr, new_len, PROT_NONE,
+				MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE, -1, 0);
+			if (probe == MAP_FAILED) {
+				proc.ireg[riscv_ireg_a0] = -errno;
+				return;
+			}
+			if (addr_t(probe) != new_addr) {
+				munmap(probe, new_len);
+				proc.ireg[riscv_ireg_a0] = -ENOMEM;
+				return;
+			}
+			void *host_addr = mremap((void*)old_addr, old_len, new_len,
+				MREMAP_MAYMOVE | MREMAP_FIXED, (void*)new_addr);
+			if (host_addr == MAP_FAILED) {
+				proc.ireg[riscv_ireg_a0] = -errno;
+				munmap(probe, new_len);
+				return;
+			}
+			regions.remove(old_addr, old_addr + old_len);
+			regions.add(new_addr, new_addr + new_len, prot);
+		} else {
+			proc.ireg[riscv_ireg_a0] = -ENOMEM;
+			return;
+		}
+
+		if (proc.flags & processor_flag_emulator_debug) {
+			debug("mremap    : %016" PRIxPTR " - %016" PRIxPTR " -> %016" PRIxPTR " - %016" PRIxPTR,
+				old_addr, old_addr + old_len, new_addr, new_addr + new_len);
+		}
+		proc.ireg[riscv_ireg_a0] = new_addr;
+	#else
+		proc.ireg[riscv_ireg_a0] = -ENOSYS;
+	#endif
+	}
+
+	/*
+	 * map anonymous memory for a file backed guest mmap and fill it
+	 *
+	 * Used when the contents come from a replay log rather than a host
+	 * file. The mapping is made writable
+	 * while fill(addr, len) runs and then gets the guest protection.
+	 */
+	template <typename P, typename F> void abi_mmap_filled(P &proc, F fill)
 	{
+		/* a2, a3 and a5 are only rewritten for the host call */
+		auto a2 = proc.ireg[riscv_ireg_a2].r.xu.val;
+		auto a3 = proc.ireg[riscv_ireg_a3].r.xu.val;
+		auto a5 = proc.ireg[riscv_ireg_a5].r.xu.val;
+		int prot = int(a2);
+		proc.ireg[riscv_ireg_a2] = prot | PROT_READ | PROT_WRITE;
+		proc.ireg[riscv_ireg_a3] = (a3 & ~abi_map_shared) | abi_map_private | abi_map_anonymous;
+		proc.ireg[riscv_ireg_a5] = 0;
+		abi_sys_mmap(proc);
+		proc.ireg[riscv_ireg_a2] = a2;
+		proc.ireg[riscv_ireg_a3] = a3;
+		proc.ireg[riscv_ireg_a5] = a5;
+		addr_t addr = proc.ireg[riscv_ireg_a0].r.xu.val;
+		if (addr & ~page_mask) return; /* -errno */
+		addr_t len = round_up(addr_t(proc.ireg[riscv_ireg_a1].r.xu.val), page_size);
+		fill(addr, len);
+		if ((prot & (PROT_READ | PROT_WRITE)) != (PROT_READ | PROT_WRITE)) {
+			mprotect((void*)addr, len, prot);
+			proc.mmu.regions.protect(addr, addr + len, prot);
+		}
+	}
+
+	/* copy from a memory file at off, returns the number of bytes copied */
+	inline size_t abi_memfile_read(fd_file *f, void *dst, size_t len, off_t off)
+	{
+		size_t size = f->mem->size;
+		if (off < 0 || size_t(off) >= size) return 0;
+		size_t n = std::min(len, size - size_t(off));
+		memcpy(dst, f->mem->data + off, n);
+		return n;
+	}
+
+	template <typename P> size_t abi_memfile_readv(P &proc, fd_file *f, off_t off)
+	{
+		const abi_iovec<P> *iov = (const abi_iovec<P>*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
+		size_t iovcnt = proc.ireg[riscv_ireg_a2].r.xu.val, total = 0;
+		for (size_t i = 0; i < iovcnt; i++) {
+			size_t n = abi_memfile_read(f, (void*)addr_t(iov[i].iov_base), iov[i].iov_len, off + total);
+			total += n;
+			if (n < iov[i].iov_len) break;
+		}
+		return total;
+	}
+
+	/*
+	 * serve syscalls on preloaded memory files
+	 *
+	 * Returns false if the syscall does not refer to a memory file.
+	 */
+	template <typename P> bool abi_memfile_syscall(P &proc)
+	{
+		int number = int(proc.ireg[riscv_ireg_a7]);
+		int fd_reg;
+		switch (number) {
+			case abi_syscall_read:
+			case abi_syscall_pread:
+			case abi_syscall_readv:
+			case abi_syscall_preadv:
+			case abi_syscall_write:
+			case abi_syscall_pwrite:
+			case abi_syscall_writev:
+			case abi_syscall_pwritev:
+			case abi_syscall_lseek:
+			case abi_syscall_fstat:
+			case abi_syscall_copy_file_range: fd_reg = riscv_ireg_a0; break;
+			case abi_syscall_sendfile:        fd_reg = riscv_ireg_a1; break;
+			case abi_syscall_mmap:            fd_reg = riscv_ireg_a4; break;
+			default: return false;
+		}
+		fd_file *f = proc.fds.get(int(proc.ireg[fd_reg]));
+		if (!f || !f->mem) return false;
+
+		void *buf = (void*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
+		size_t len = proc.ireg[riscv_ireg_a2].r.xu.val;
+		s64 ret;
+		switch (number) {
+			case abi_syscall_read:
+				ret = abi_memfile_read(f, buf, len, f->pos);
+				f->pos += ret;
+				break;
+			case abi_syscall_pread:
+				ret = abi_memfile_read(f, buf, len, off_t(proc.ireg[riscv_ireg_a3].r.xu.val));
+				break;
+			case abi_syscall_readv:
+				ret = abi_memfile_readv(proc, f, f->pos);
+				f->pos += ret;
+				break;
+			case abi_syscall_preadv:
+				ret = abi_memfile_readv(proc, f, abi_offset(proc, riscv_ireg_a3, riscv_ireg_a4));
+				break;
+			case abi_syscall_lseek:
+			{
+				off_t off = off_t(proc.ireg[riscv_ireg_a1].r.xu.val);
+				switch (int(proc.ireg[riscv_ireg_a2])) {
+					case SEEK_SET: break;
+					case SEEK_CUR: off += f->pos; break;
+					case SEEK_END: off += f->mem->size; break;
+					default: off = -1; break;
+				}
+				ret = off < 0 ? -EINVAL : (f->pos = off);
+				break;
+			}
+			case abi_syscall_fstat:
+				cvt_abi_stat((abi_stat<P>*)buf, &f->mem->st);
+				ret = 0;
+				break;
+			case abi_syscall_sendfile:
+			{
+				/* guest off_t is XLEN wide */
+				typename P::long_t *guest_off = (typename P::long_t*)(addr_t)proc.ireg[riscv_ireg_a2].r.xu.val;
+				off_t off = guest_off ? off_t(*guest_off) : f->pos;
+				size_t size = f->mem->size;
+				size_t n = off < 0 || size_t(off) >= size ? 0 :
+					std::min(size_t(proc.ireg[riscv_ireg_a3].r.xu.val), size - size_t(off));
+				ret = write(proc.fds.host_fd(int(proc.ireg[riscv_ireg_a0])), f->mem->data + off, n);
+				if (ret < 0) { ret = -errno; break; }
+				if (guest_off) *guest_off = off + ret;
+				else f->pos += ret;
+				break;
+			}
+			case abi_syscall_copy_file_range:
+			{
+				u64 *off_in = (u64*)(addr_t)proc.ireg[riscv_ireg_a1].r.xu.val;
+				u64 *off_out = (u64*)(addr_t)proc.ireg[riscv_ireg_a3].r.xu.val;
+				off_t off = off_in ? off_t(*off_in) : f->pos;
+				size_t size = f->mem->size;
+				size_t n = off < 0 || size_t(off) >= size ? 0 :
+					std::min(size_t(proc.ireg[riscv_ireg_a4].r.xu.val), size - size_t(off));
+				int out_fd = proc.fds.host_fd(int(proc.ireg[riscv_ireg_a2]));
+				ret = off_out ? pwrite(out_fd, f->mem->data + off, n, off_t(*off_out)) :
+					write(out_fd, f->mem->data + off, n);
+				if (ret < 0) { ret = -errno; break; }
+				if (off_in) *off_in += ret;
+				else f->pos += ret;
+				if (off_out) *off_out += ret;
+				break;
+			}
+			case abi_syscall_mmap:
+			{
+				int prot = int(proc.ireg[riscv_ireg_a2]);
+				if ((proc.ireg[riscv_ireg_a3].r.xu.val & abi_map_shared) && (prot & PROT_WRITE)) {
+					ret = -EACCES;
+					break;
+				}
+				/* map the resident pages of the preloaded file, private writes are copy on write */
+				abi_mmap_host_fd(proc, f->mem->fd);
+				return true;
+			}
+			default:
+				/* memory files are read-only */
+				ret = -EBADF;
+				break;
+		}
+		proc.ireg[riscv_ireg_a0] = ret;
+		return true;
+	}
+
+	template <typename P>
+	struct abi_offload_request
+	{
+		typedef abi_syscall_frame<P> frame_type;
+
+		frame_type frame;
+		void (*call)(frame_type &frame);
+
+		abi_offload_request() : frame(), call(nullptr) {}
+
+		void run() { call(frame); }
+	};
+
+	/*
+	 * hand a potentially blocking syscall to the offload pool
+	 *
+	 * The hart is parked until the result is written back at a block
+	 * boundary. The emulator runs a single hart, so nothing runs in the
+	 * meantime and each call pays for two thread handoffs; offload is
+	 * off unless requested with --async-io and is not a speedup.
+	 * Returns false for syscalls that are run synchronously.
+	 */
+	template <typename P> bool abi_offload_syscall(P &proc)
+	{
+		typedef typename P::offload_request_type::frame_type frame_type;
+		void (*call)(frame_type &frame);
+		switch (proc.ireg[riscv_ireg_a7]) {
+			case abi_syscall_read:          call = abi_sys_read<frame_type>; break;
+			case abi_syscall_write:         call = abi_sys_write<frame_type>; break;
+			case abi_syscall_readv:         call = abi_sys_readv<frame_type>; break;
+			case abi_syscall_writev:        call = abi_sys_writev<frame_type>; break;
+			case abi_syscall_pread:         call = abi_sys_pread<frame_type>; break;
+			case abi_syscall_pwrite:        call = abi_sys_pwrite<frame_type>; break;
+			case abi_syscall_preadv:        call = abi_sys_preadv<frame_type>; break;
+			case abi_syscall_pwritev:       call = abi_sys_pwritev<frame_type>; break;
+			case abi_syscall_sendfile:      call = abi_sys_sendfile<frame_type>; break;
+			case abi_syscall_copy_file_range: call = abi_sys_copy_file_range<frame_type>; break;
+			default: return false;
+		}
+		auto &req = proc.io_request;
+		std::copy(proc.ireg, proc.ireg + P::ireg_count, req.frame.ireg);
+
+		// translate guest fds, memory files are served synchronously
+		int fd_regs[2] = { riscv_ireg_a0, -1 };
+		if (call == abi_sys_sendfile<frame_type>) fd_regs[1] = riscv_ireg_a1;
+		if (call == abi_sys_copy_file_range<frame_type>) fd_regs[1] = riscv_ireg_a2;
+		for (int reg : fd_regs) {
+			if (reg < 0) continue;
+			fd_file *f = proc.fds.get(int(proc.ireg[reg]));
+			if (f && f->mem) return false;
+			req.frame.ireg[reg] = f ? f->host_fd : -1;
+		}
+		req.call = call;
+		proc.io_parked_flag = true;
+		proc.io_pool->submit(&req);
+		return true;
+	}
+
+	template <typename P> void abi_dispatch_syscall(P &proc)
+	{
+		if (abi_memfile_syscall(proc)) return;
 		switch (proc.ireg[riscv_ireg_a7]) {
+			case abi_syscall_dup:           abi_sys_dup(proc); break;
+			case abi_syscall_dup3:          abi_sys_dup3(proc); break;
+			case abi_syscall_fcntl:         abi_sys_fcntl(proc); break;
+			case abi_syscall_openat:        abi_sys_openat(proc); break;
 			case abi_syscall_close:         abi_sys_close(proc); break;
 			case abi_syscall_lseek:         abi_sys_lseek(proc); break;
 			case abi_syscall_read:          abi_sys_read(proc);  break;
 			case abi_syscall_write:         abi_sys_write(proc); break;
 			case abi_syscall_pread:         abi_sys_pread(proc); break;
 			case abi_syscall_pwrite:        abi_sys_pwrite(proc); break;
+			case abi_syscall_readv:         abi_sys_readv(proc); break;
+			case abi_syscall_writev:        abi_sys_writev(proc); break;
+			case abi_syscall_preadv:        abi_sys_preadv(proc); break;
+			case abi_syscall_pwritev:       abi_sys_pwritev(proc); break;
+			case abi_syscall_sendfile:      abi_sys_sendfile(proc); break;
+			case abi_syscall_copy_file_range: abi_sys_copy_file_range(proc); break;
 			case abi_syscall_fstat:         abi_sys_fstat(proc); break;
 			case abi_syscall_exit:          abi_sys_exit(proc); break;
+			case abi_syscall_clock_gettime: abi_sys_clock_gettime(proc); break;
 			case abi_syscall_gettimeofday:  abi_sys_gettimeofday(proc);break;
 			case abi_syscall_brk:           abi_sys_brk(proc); break;
+			case abi_syscall_munmap:        abi_sys_munmap(proc); break;
+			case abi_syscall_mremap:        abi_sys_mremap(proc); break;
+			case abi_syscall_mmap:          abi_sys_mmap(proc); break;
+			case abi_syscall_mprotect:      abi_sys_mprotect(proc); break;
 			default: panic("unknown syscall: %d", proc.ireg[riscv_ireg_a7]);
 		}
 	}
 
+	/* the syscall result in a0 as a signed value */
+	template <typename P> s64 abi_result(P &proc)
+	{
+		return s64(typename P::long_t(proc.ireg[riscv_ireg_a0].r.xu.val));
+	}
+
+	/* note the guest memory written by a syscall so it can be replayed */
+	template <typename P> void abi_log_outputs(P &proc, u32 number, const u64 *a, s64 r)
+	{
+		auto &log = proc.sys_log;
+		switch (number) {
+			case abi_syscall_read:
+			case abi_syscall_pread:
+				if (r > 0) log.add_mem(a[1], r);
+				break;
+			case abi_syscall_readv:
+			case abi_syscall_preadv:
+			{
+				const abi_iovec<P> *iov = (const abi_iovec<P>*)addr_t(a[1]);
+				for (u64 i = 0; i < a[2] && r > 0; i++) {
+					s64 n = std::min(r, s64(iov[i].iov_len));
+					log.add_mem(iov[i].iov_base, n);
+					r -= n;
+				}
+				break;
+			}
+			case abi_syscall_fstat:
+				if (r == 0) log.add_mem(a[1], sizeof(abi_stat<P>));
+				break;
+			case abi_syscall_clock_gettime:
+				if (r == 0) log.add_mem(a[1], sizeof(abi_timespec<P>));
+				break;
+			case abi_syscall_gettimeofday:
+				if (r == 0) log.add_mem(a[0], sizeof(abi_timeval<P>));
+				if (r == 0) log.add_mem(a[1], sizeof(abi_timezone<P>));
+				break;
+			case abi_syscall_sendfile:
+				if (r >= 0) log.add_mem(a[2], sizeof(typename P::long_t));
+				break;
+			case abi_syscall_copy_file_range:
+				if (r >= 0) log.add_mem(a[1], sizeof(u64));
+				if (r >= 0) log.add_mem(a[3], sizeof(u64));
+				break;
+			case abi_syscall_mmap:
+			{
+				/* file contents are logged so replay does not need the file */
+				struct stat st;
+				u64 size;
+				if (r < 0 && r > -4096) break;
+				if ((a[3] & abi_map_anonymous) || !(a[2] & PROT_READ)) break;
+				fd_file *f = proc.fds.get(int(a[4]));
+				if (!f) break;
+				if (f->mem) size = f->mem->size;
+				else if (fstat(f->host_fd, &st) == 0) size = st.st_size;
+				else break;
+				if (size <= a[5]) break;
+				log.add_mem(r, std::min(a[1], size - a[5]));
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	/* run a syscall and append its result and memory outputs to the log */
+	template <typename P> void abi_record_syscall(P &proc)
+	{
+		u32 number = proc.ireg[riscv_ireg_a7];
+		u64 a[6];
+		for (int i = 0; i < 6; i++) a[i] = proc.ireg[riscv_ireg_a0 + i].r.xu.val;
+		if (number == abi_syscall_exit) proc.sys_log.flush();
+		abi_dispatch_syscall(proc);
+		s64 r = abi_result(proc);
+		abi_log_outputs(proc, number, a, r);
+		proc.sys_log.write(number, a, r);
+	}
+
+	/*
+	 * serve a syscall from the log without touching the host
+	 *
+	 * Address space syscalls are still run so the guest memory layout is
+	 * rebuilt, with file backed mappings replaced by anonymous mappings
+	 * that are filled from the log. Their results must match the log.
+	 */
+	template <typename P> void abi_replay_syscall(P &proc)
+	{
+		auto &log = proc.sys_log;
+		u32 number = proc.ireg[riscv_ireg_a7];
+		if (number == abi_syscall_exit) {
+			abi_dispatch_syscall(proc);
+			return;
+		}
+
+		syscall_log_record rec;
+		log.read(rec);
+		if (rec.number != number) {
+			panic("syscall_log: replay diverged at record %" PRIu64 ": syscall %u, log has %u",
+				log.count, number, rec.number);
+		}
+		for (int i = 0; i < 6; i++) {
+			u64 arg = proc.ireg[riscv_ireg_a0 + i].r.xu.val;
+			if (arg != rec.args[i]) {
+				panic("syscall_log: replay diverged at record %" PRIu64 ": syscall %u a%d=0x%" PRIx64
+					", log has 0x%" PRIx64, log.count, number, i, arg, rec.args[i]);
+			}
+		}
+
+		auto check_result = [&] {
+			if (abi_result(proc) != rec.result) {
+				panic("syscall_log: replay diverged at record %" PRIu64 ": syscall %u returned %" PRId64
+					", log has %" PRId64, log.count, number, abi_result(proc), rec.result);
+			}
+		};
+		auto read_outputs = [&] {
+			for (u32 i = 0; i < rec.mem_count; i++) {
+				syscall_log_mem m;
+				log.read_mem(m);
+				if (!proc.mmu.regions.contains(m.addr, m.addr + m.len)) {
+					panic("syscall_log: replay output %016" PRIx64 " - %016" PRIx64 " is not guest memory",
+						m.addr, m.addr + m.len);
+				}
+				log.read_bytes((void*)addr_t(m.addr), m.len);
+			}
+		};
+
+		switch (number) {
+			case abi_syscall_mmap:
+				if (!(proc.ireg[riscv_ireg_a3].r.xu.val & abi_map_anonymous)) {
+					/* file contents come from the log */
+					abi_mmap_filled(proc, [&](addr_t addr, addr_t len) {
+						check_result();
+						read_outputs();
+					});
+					check_result();
+					return;
+				}
+				/* fall through */
+			case abi_syscall_brk:
+			case abi_syscall_munmap:
+			case abi_syscall_mprotect:
+			case abi_syscall_mremap:
+				abi_dispatch_syscall(proc);
+				check_result();
+				break;
+			default:
+				proc.ireg[riscv_ireg_a0] = rec.result;
+				break;
+		}
+		read_outputs();
+	}
+
+	template <typename P> void abi_proxy_syscall(P &proc)
+	{
+		switch (proc.sys_log.mode) {
+			case syscall_log_mode_record: abi_record_syscall(proc); return;
+			case syscall_log_mode_replay: abi_replay_syscall(proc); return;
+			default: break;
+		}
+		if (proc.io_pool && abi_offload_syscall(proc)) return;
+		abi_dispatch_syscall(proc);
+	}
+
+	/* append the trace record of the current syscall */
+	template <typename P> void abi_trace_complete(P &proc)
+	{
+		proc.trace_pending.duration = cpu_cycle_clock() - proc.trace_pending.start;
+		proc.trace_pending.result = abi_result(proc);
+		proc.trace->append(proc.trace_pending);
+	}
+
+	template <typename P> void abi_trace_syscall(P &proc)
+	{
+		syscall_trace_record &rec = proc.trace_pending;
+		rec.number = u32(proc.ireg[riscv_ireg_a7]);
+		for (int i = 0; i < 6; i++) rec.args[i] = proc.ireg[riscv_ireg_a0 + i].r.xu.val;
+		if (rec.number == abi_syscall_exit) {
+			/* exit does not return, write the trace out first */
+			rec.start = cpu_cycle_clock();
+			rec.duration = 0;
+			rec.result = 0;
+			proc.trace->append(rec);
+			proc.trace->flush();
+		}
+		rec.start = cpu_cycle_clock();
+		abi_proxy_syscall(proc);
+		if (proc.io_parked()) return; /* completed in io_poll */
+		abi_trace_complete(proc);
+	}
+
+	template <typename P> void proxy_syscall(P &proc)
+	{
+		if (proc.trace) abi_trace_syscall(proc);
+		else abi_proxy_syscall(proc);
+	}
+
 }
 
 #endif
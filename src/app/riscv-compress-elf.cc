@@ -28,9 +28,11 @@
 #include "riscv-meta.h"
 #include "riscv-jit.h"
 #include "riscv-util.h"
+#include "riscv-host.h"
 #include "riscv-cmdline.h"
 #include "riscv-color.h"
 #include "riscv-codec.h"
+#include "riscv-batch.h"
 #include "riscv-strings.h"
 #include "riscv-disasm.h"
 #include "riscv-elf.h"
@@ -221,8 +223,8 @@ struct riscv_compress_elf
 		typename std::deque<T>::iterator bi,
 		typename std::deque<T>::iterator bend)
 	{
-		switch (dec.op) {
-			case riscv_op_jal:
+		switch (riscv_inst_props[dec.op].flow) {
+			case riscv_flow_call:
 			{
 				dec.is_pcrel = true;
 				dec.addr = dec.pc + dec.imm;
@@ -231,7 +233,7 @@ struct riscv_compress_elf
 					dec.label_branch = ci->second;
 				}
 			}
-			case riscv_op_jalr:
+			case riscv_flow_call_indirect:
 			{
 				if (bi + 1 != bend) {
 					uint64_t cont_addr = (bi + 1)->pc;
@@ -240,11 +242,7 @@ struct riscv_compress_elf
 				}
 				return true;
 			}
-			default:
-				break;
-		}
-		switch (dec.codec) {
-			case riscv_codec_sb:
+			case riscv_flow_branch:
 			{
 				dec.is_pcrel = true;
 				dec.addr = dec.pc + dec.imm;
@@ -265,44 +263,36 @@ struct riscv_compress_elf
 	bool deocde_gprel(T &dec, addr_t gp)
 	{
 		if (!gp || dec.rs1 != riscv_ireg_gp) return false;
-		switch (dec.op) {
-			case riscv_op_addi:
-			case riscv_op_lb:
-			case riscv_op_lh:
-			case riscv_op_lw:
-			case riscv_op_ld:
-			case riscv_op_lbu:
-			case riscv_op_lhu:
-			case riscv_op_lwu:
-			case riscv_op_flw:
-			case riscv_op_fld:
-			case riscv_op_sb:
-			case riscv_op_sh:
-			case riscv_op_sw:
-			case riscv_op_sd:
-			case riscv_op_fsw:
-			case riscv_op_fsd:
-				dec.is_gprel = true;
-				dec.addr = int64_t(gp + dec.imm);
-				return true;
-			default:
+		switch (riscv_inst_props[dec.op].mem) {
+			case riscv_mem_load:
+			case riscv_mem_store:
 				break;
+			default:
+				if (dec.op != riscv_op_addi) return false;
 		}
-		return false;
+		dec.is_gprel = true;
+		dec.addr = int64_t(gp + dec.imm);
+		return true;
 	}
 
 	void disassemble(std::deque<spasm> &bin, addr_t start, addr_t end, addr_t pc_bias)
 	{
-		addr_t pc_offset;
+		const size_t batch_size = 256;
+		inst_t inst[batch_size];
+		u8 len[batch_size];
 		addr_t pc = start;
 		while (pc < end) {
-			bin.resize(bin.size() + 1);
-			auto &dec = bin.back();
-			dec.pc = pc - pc_bias;
-			dec.inst = inst_fetch(pc, pc_offset);
-			decode_inst_rv64(dec, dec.inst);
-			decompress_inst_rv64(dec);
-			pc += pc_offset;
+			addr_t addr = pc;
+			size_t count = inst_fetch_batch(pc, end, inst, len, batch_size);
+			for (size_t i = 0; i < count; i++) {
+				bin.resize(bin.size() + 1);
+				auto &dec = bin.back();
+				dec.pc = addr - pc_bias;
+				dec.inst = inst[i];
+				decode_inst_rv64(dec, dec.inst);
+				decompress_inst_rv64(dec);
+				addr += len[i];
+			}
 		}
 	}
 
@@ -320,9 +310,9 @@ struct riscv_compress_elf
 			if (!decoded_address) decoded_address = deocde_gprel(dec, gp);
 
 			// clear instruction history on jump boundaries
-			switch(dec.op) {
-				case riscv_op_jal:
-				case riscv_op_jalr:
+			switch (riscv_inst_props[dec.op].flow) {
+				case riscv_flow_call:
+				case riscv_flow_call_indirect:
 					dec_hist.clear();
 					break;
 				default:
@@ -614,6 +604,9 @@ int main(int argc, const char *argv[])
 	printf("sizeof(disasm) = %lu\n", sizeof(disasm));
 	printf("sizeof(spasm) = %lu\n", sizeof(spasm));
 
+	imm_operand_host<>::bmi2 = host_cpu::get_instance().caps["BMI2"] != 0;
+	inst_batch_host<>::avx2 = host_cpu::get_instance().caps["AVX2"] != 0;
+
 	riscv_compress_elf elf_compress;
 	elf_compress.parse_commandline(argc, argv);
 	elf_compress.run();
@@ -26,9 +26,11 @@
 #include "riscv-format.h"
 #include "riscv-meta.h"
 #include "riscv-util.h"
+#include "riscv-host.h"
 #include "riscv-cmdline.h"
 #include "riscv-color.h"
 #include "riscv-codec.h"
+#include "riscv-batch.h"
 #include "riscv-strings.h"
 #include "riscv-disasm.h"
 #include "riscv-elf.h"
@@ -98,19 +100,19 @@ struct riscv_histogram_elf
 
 	void histogram(map_t &hist, addr_t start, addr_t end)
 	{
-		decode dec;
-		addr_t pc_offset;
+		std::unique_ptr<decode_batch<decode>> batch(new decode_batch<decode>());
 		addr_t pc = start;
 		while (pc < end) {
-			uint64_t inst = inst_fetch(pc, pc_offset);
-			decode_inst_rv64(dec, inst);
-			if (inst_histogram) {
-				histogram_add(hist, riscv_inst_name_sym[dec.op]);
+			size_t count = batch->decode_rv64(pc, end);
+			for (size_t i = 0; i < count; i++) {
+				decode &dec = batch->dec[i];
+				if (inst_histogram) {
+					histogram_add(hist, riscv_inst_name_sym[dec.op]);
+				}
+				if (regs_histogram) {
+					histogram_add_regs(hist, dec);
+				}
 			}
-			if (regs_histogram) {
-				histogram_add_regs(hist, dec);
-			}
-			pc += pc_offset;
 		}
 	}
 
@@ -212,6 +214,9 @@ struct riscv_histogram_elf
 
 int main(int argc, const char *argv[])
 {
+	imm_operand_host<>::bmi2 = host_cpu::get_instance().caps["BMI2"] != 0;
+	inst_batch_host<>::avx2 = host_cpu::get_instance().caps["AVX2"] != 0;
+
 	riscv_histogram_elf elf_histogram;
 	elf_histogram.parse_commandline(argc, argv);
 	elf_histogram.run();
@@ -27,9 +27,11 @@
 #include "riscv-format.h"
 #include "riscv-meta.h"
 #include "riscv-util.h"
+#include "riscv-host.h"
 #include "riscv-cmdline.h"
 #include "riscv-color.h"
 #include "riscv-codec.h"
+#include "riscv-batch.h"
 #include "riscv-strings.h"
 #include "riscv-disasm.h"
 #include "riscv-elf.h"
@@ -111,38 +113,39 @@ struct riscv_parse_elf
 
 	void scan_continuations(addr_t start, addr_t end, addr_t pc_bias)
 	{
-		disasm dec;
-		addr_t pc = start;
-		addr_t pc_offset;
+		std::unique_ptr<decode_batch<decode>> batch(new decode_batch<decode>());
+		addr_t next = start;
 		addr_t addr = 0;
-		while (pc < end) {
-			dec.pc = pc;
-			dec.inst = inst_fetch(pc, pc_offset);
-			decode_inst_rv64(dec, dec.inst);
-			switch (dec.op) {
-				case riscv_op_jal:
-				case riscv_op_jalr:
-					if (pc + pc_offset < end) {
-						addr = pc - pc_bias + pc_offset;
+		while (next < end) {
+			size_t count = batch->decode_rv64(next, end);
+			for (size_t i = 0; i < count; i++) {
+				decode &dec = batch->dec[i];
+				addr_t pc = batch->pc[i];
+				addr_t pc_offset = batch->len[i];
+				switch (riscv_inst_props[dec.op].flow) {
+					case riscv_flow_call:
+					case riscv_flow_call_indirect:
+						if (pc + pc_offset < end) {
+							addr = pc - pc_bias + pc_offset;
+							if (continuations.find(addr) == continuations.end()) {
+								continuations.insert(std::pair<addr_t,uint32_t>(addr, continuation_num++));
+							}
+						}
+						break;
+					default:
+						break;
+				}
+				switch (dec.codec) {
+					case riscv_codec_sb:
+						addr = pc - pc_bias + dec.imm;
 						if (continuations.find(addr) == continuations.end()) {
 							continuations.insert(std::pair<addr_t,uint32_t>(addr, continuation_num++));
 						}
-					}
-					break;
-				default:
-					break;
-			}
-			switch (dec.codec) {
-				case riscv_codec_sb:
-					addr = pc - pc_bias + dec.imm;
-					if (continuations.find(addr) == continuations.end()) {
-						continuations.insert(std::pair<addr_t,uint32_t>(addr, continuation_num++));
-					}
-					break;
-				default:
-					break;
+						break;
+					default:
+						break;
+				}
 			}
-			pc += pc_offset;
 		}
 	}
 
@@ -268,6 +271,9 @@ struct riscv_parse_elf
 
 int main(int argc, const char *argv[])
 {
+	imm_operand_host<>::bmi2 = host_cpu::get_instance().caps["BMI2"] != 0;
+	inst_batch_host<>::avx2 = host_cpu::get_instance().caps["AVX2"] != 0;
+
 	riscv_parse_elf elf_parser;
 	elf_parser.parse_commandline(argc, argv);
 	elf_parser.run();
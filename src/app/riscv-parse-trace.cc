@@ -0,0 +1,182 @@
+//
+//  riscv-parse-trace.cc
+//
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cstdarg>
+#include <cerrno>
+#include <cinttypes>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "riscv-types.h"
+#include "riscv-bits.h"
+#include "riscv-util.h"
+#include "riscv-cmdline.h"
+#include "riscv-console.h"
+#include "riscv-abi-syscall.h"
+#include "riscv-syscall-trace.h"
+
+using namespace riscv;
+
+struct riscv_parse_trace
+{
+	std::string filename;
+	syscall_trace_header hdr;
+	std::vector<syscall_trace_record> recs;
+
+	bool help_or_error = false;
+	bool summary = false;
+	bool raw_ticks = false;
+
+	struct syscall_stats
+	{
+		u64 count;
+		u64 errors;
+		u64 total;
+		u64 max;
+	};
+
+	void load()
+	{
+		FILE *file = fopen(filename.c_str(), "rb");
+		if (!file) {
+			panic("error: fopen: %s: %s", filename.c_str(), strerror(errno));
+		}
+		if (fread(&hdr, sizeof(hdr), 1, file) != 1 || memcmp(hdr.magic, "RVST", 4) != 0 ||
+			hdr.version != syscall_trace_file::version ||
+			hdr.record_size != sizeof(syscall_trace_record))
+		{
+			panic("error: %s: not a version %d syscall trace", filename.c_str(),
+				syscall_trace_file::version);
+		}
+		syscall_trace_record rec;
+		while (fread(&rec, sizeof(rec), 1, file) == 1) recs.push_back(rec);
+		fclose(file);
+	}
+
+	/* ticks to nanoseconds using the 32.32 scale from the header */
+	u64 ticks_ns(u64 d)
+	{
+		if (raw_ticks || hdr.tick_scale == 0) return d;
+		return (d >> 32) * hdr.tick_scale + (((d & 0xffffffff) * hdr.tick_scale) >> 32);
+	}
+
+	std::string syscall_name(u32 number)
+	{
+		const char *name = abi_syscall_name(number);
+		return name ? name : format_string("syscall_%u", number);
+	}
+
+	void print_records()
+	{
+		u64 base = recs.size() > 0 ? recs[0].start : 0;
+		for (auto &rec : recs) {
+			printf("%12llu [%u] %s(0x%llx, 0x%llx, 0x%llx, 0x%llx, 0x%llx, 0x%llx) = %lld <%llu>\n",
+				(unsigned long long)ticks_ns(rec.start - base), rec.hart_id,
+				syscall_name(rec.number).c_str(),
+				(unsigned long long)rec.args[0], (unsigned long long)rec.args[1],
+				(unsigned long long)rec.args[2], (unsigned long long)rec.args[3],
+				(unsigned long long)rec.args[4], (unsigned long long)rec.args[5],
+				(long long)rec.result, (unsigned long long)ticks_ns(rec.duration));
+		}
+	}
+
+	void print_summary()
+	{
+		std::map<u32,syscall_stats> stats;
+		u64 total = 0;
+		for (auto &rec : recs) {
+			syscall_stats &s = stats[rec.number];
+			u64 d = ticks_ns(rec.duration);
+			s.count++;
+			s.errors += (rec.result < 0 && rec.result >= -4095);
+			s.total += d;
+			s.max = std::max(s.max, d);
+			total += d;
+		}
+
+		/* sort by total time to show the hotspots first */
+		std::vector<std::pair<u32,syscall_stats>> sorted(stats.begin(), stats.end());
+		std::sort(sorted.begin(), sorted.end(), [] (const std::pair<u32,syscall_stats> &a,
+			const std::pair<u32,syscall_stats> &b) { return a.second.total > b.second.total; });
+
+		const char *unit = raw_ticks || hdr.tick_scale == 0 ? "ticks" : "ns";
+		printf("%6s %14s %10s %12s %12s %8s  %s\n",
+			"% time", unit, "calls", "avg", "max", "errors", "syscall");
+		for (auto &ent : sorted) {
+			syscall_stats &s = ent.second;
+			printf("%6.2f %14llu %10llu %12llu %12llu %8llu  %s\n",
+				total ? 100.0 * s.total / total : 0.0, (unsigned long long)s.total,
+				(unsigned long long)s.count, (unsigned long long)(s.total / s.count),
+				(unsigned long long)s.max, (unsigned long long)s.errors,
+				syscall_name(ent.first).c_str());
+		}
+		printf("%6s %14llu %10zu %12s %12s %8s  %s\n",
+			"100.00", (unsigned long long)total, recs.size(), "", "", "", "total");
+	}
+
+	void parse_commandline(int argc, const char *argv[])
+	{
+		cmdline_option options[] =
+		{
+			{ "-h", "--help", cmdline_arg_type_none,
+				"Show help",
+				[&](std::string s) { return (help_or_error = true); } },
+			{ "-s", "--summary", cmdline_arg_type_none,
+				"Print per-syscall count and time summary",
+				[&](std::string s) { return (summary = true); } },
+			{ "-t", "--ticks", cmdline_arg_type_none,
+				"Print times in cycle counter ticks",
+				[&](std::string s) { return (raw_ticks = true); } },
+			{ nullptr, nullptr, cmdline_arg_type_none,   nullptr, nullptr }
+		};
+
+		auto result = cmdline_option::process_options(options, argc, argv);
+		if (!result.second) {
+			help_or_error = true;
+		} else if (result.first.size() != 1) {
+			printf("%s: wrong number of arguments\n", argv[0]);
+			help_or_error = true;
+		}
+
+		if (help_or_error)
+		{
+			printf("usage: %s [<options>] <trace_file>\n", argv[0]);
+			cmdline_option::print_options(options);
+			exit(9);
+		}
+
+		filename = result.first[0];
+	}
+
+	void run()
+	{
+		load();
+		if (summary) print_summary();
+		else print_records();
+	}
+};
+
+int main(int argc, const char *argv[])
+{
+	riscv_parse_trace parse_trace;
+	parse_trace.parse_commandline(argc, argv);
+	parse_trace.run();
+	return 0;
+}
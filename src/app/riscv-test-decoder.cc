@@ -0,0 +1,569 @@
+//
+//  riscv-test-decoder.cc
+//
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cstdarg>
+#include <cerrno>
+#include <cinttypes>
+#include <cmath>
+#include <cfenv>
+#include <limits>
+#include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <map>
+#include <thread>
+#undef NDEBUG
+#include <cassert>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <dirent.h>
+
+#include "riscv-endian.h"
+#include "riscv-types.h"
+#include "riscv-bits.h"
+#include "riscv-host.h"
+#include "riscv-util.h"
+#include "riscv-meta.h"
+#include "riscv-codec.h"
+#include "riscv-batch.h"
+#include "riscv-predecode.h"
+#include "riscv-alu.h"
+#include "riscv-fpu.h"
+#include "riscv-interp.h"
+
+namespace riscv
+{
+	/*
+	 * Table decoder, benchmarked against the switch decoder
+	 *
+	 * Finds the opcode by walking the generated decode table. It is slower
+	 * than the generated switch so it is only built into this test.
+	 */
+
+	#include "riscv-table.h"
+
+	template <typename T, bool rv32, bool rv64, bool rvi = true, bool rvm = true, bool rva = true, bool rvs = true, bool rvf = true, bool rvd = true, bool rvc = true>
+	inline void decode_inst_table(T &dec, inst_t inst)
+	{
+		dec.op = decode_inst_op_table<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,rvc>(inst);
+		decode_inst_type<T>(dec, inst);
+	}
+}
+
+using namespace riscv;
+
+/* compare the compressed instruction table with the switch decoder for every parcel */
+template <bool rv32, bool rv64, bool rvi, bool rvm, bool rva, bool rvs, bool rvf, bool rvd>
+void test_rvc_table(const char *isa)
+{
+	size_t legal = 0;
+	for (inst_t inst = 0; inst < 65536; inst++) {
+		if ((inst & 0b11) == 0b11) continue;
+		decode ref, dec;
+		decode_inst<decode,rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,true>(ref, inst);
+		if (rv32) decompress_inst_rv32<decode>(ref);
+		else decompress_inst_rv64<decode>(ref);
+		decode_inst_rvc<decode,rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,true>(dec, inst);
+		if (ref.imm != dec.imm || ref.rd != dec.rd || ref.rs1 != dec.rs1 ||
+			ref.rs2 != dec.rs2 || ref.rs3 != dec.rs3 || ref.op != dec.op ||
+			ref.codec != dec.codec || ref.rm != dec.rm || ref.aq != dec.aq ||
+			ref.rl != dec.rl || ref.pred != dec.pred || ref.succ != dec.succ)
+		{
+			printf("FAIL %s inst=0x%04x op=%d/%d imm=%d/%d\n", isa, u32(inst),
+				ref.op, dec.op, ref.imm, dec.imm);
+			assert(false);
+		}
+		legal += (ref.op != riscv_op_illegal);
+	}
+	printf("PASS test_rvc_table %-8s (%zu legal parcels)\n", isa, legal);
+}
+
+/* xorshift64 for reproducible instruction samples */
+static u64 next_rand(u64 &s)
+{
+	s ^= s << 13;
+	s ^= s >> 7;
+	s ^= s << 17;
+	return s;
+}
+
+/* opcode match bits with random operand bits, plus random words */
+static std::vector<inst_t> sample_insts(size_t count)
+{
+	std::vector<inst_t> insts;
+	u64 s = 0x9e3779b97f4a7c15ULL;
+	for (size_t i = 0; i < count; i++) {
+		u64 r = next_rand(s);
+		opcode_t op = (r >> 32) % riscv_op_fsflagsi + 1;
+		inst_t inst = (i & 7) == 7 ? (r & 0xffffffff) :
+			riscv_inst_match[op] | (r & ~riscv_inst_mask[op] & 0xffffffff);
+		insts.push_back(inst);
+	}
+	return insts;
+}
+
+/* compare the table decoder with the switch decoder */
+template <bool rv32, bool rv64, bool rvi, bool rvm, bool rva, bool rvs, bool rvf, bool rvd, bool rvc>
+void test_decode_table(const char *isa, std::vector<inst_t> &insts)
+{
+	for (inst_t inst = 0; inst < 65536; inst++) {
+		assert((decode_inst_op<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,rvc>(inst) ==
+			decode_inst_op_table<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,rvc>(inst)));
+	}
+	for (auto inst : insts) {
+		opcode_t ref = decode_inst_op<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,rvc>(inst);
+		opcode_t op = decode_inst_op_table<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,rvc>(inst);
+		if (ref != op) {
+			printf("FAIL %s inst=0x%08x op=%u/%u\n", isa, u32(inst), ref, op);
+			assert(false);
+		}
+	}
+	printf("PASS test_decode_table %-8s\n", isa);
+}
+
+#if RISCV_IMM_BMI2
+/* compare pext/pdep operand decode and encode with the portable path */
+template <typename OP>
+void test_operand_bmi2(const char *name)
+{
+	typedef typename OP::I I;
+	u64 s = 0x2545f4914f6cdd1dULL;
+	for (size_t i = 0; i < 65536; i++) {
+		u64 r = next_rand(s);
+		assert(imm_decode_pext<I>(r & 0xffffffff) == u64(I::decode(r & 0xffffffff)));
+		assert(imm_encode_pdep<I>(r) == u64(I::encode(r)));
+	}
+	printf("PASS test_operand_bmi2 %-12s chains=%d%s\n", name, imm_operand_chains<I>().count,
+		imm_operand_bmi2<I>() ? " (pext)" : "");
+}
+#endif
+
+/* compare the compact decode with the full decode */
+template <bool rv32, bool rv64>
+void test_decode_compact(const char *isa, std::vector<inst_t> &insts)
+{
+	static_assert(sizeof(decode_compact) == 8, "decode_compact must be 8 bytes");
+	size_t r4 = 0;
+	for (auto inst : insts) {
+		decode dec;
+		decode_inst<decode,rv32,rv64>(dec, inst);
+		decode_compact cdec(dec);
+		assert(cdec.op == dec.op && cdec.rd == dec.rd && cdec.rs1 == dec.rs1 && cdec.rs2 == dec.rs2);
+		if (dec.codec == riscv_codec_r4_m) {
+			assert(cdec.rs3 == dec.rs3 && dec.imm == 0);
+			r4++;
+		} else {
+			assert(cdec.imm == dec.imm);
+		}
+	}
+	printf("PASS test_decode_compact %-8s (%zu r4)\n", isa, r4);
+}
+
+/* canonicalized instructions are the real opcode, a pseudo of it or nop for writes to x0 */
+template <bool rv32, bool rv64>
+void test_canonicalize(const char *isa, std::vector<inst_t> &insts)
+{
+	size_t rewritten = 0;
+	for (auto inst : insts) {
+		decode dec, canon;
+		decode_inst<decode,rv32,rv64>(dec, inst);
+		canon = dec;
+		if (rv32) canonicalize_inst_rv32<decode>(canon);
+		else canonicalize_inst_rv64<decode>(canon);
+		assert(canon.codec == riscv_inst_codec[canon.op]);
+		if (canon.op == dec.op) continue;
+		assert(canon.op == riscv_op_nop || riscv_inst_depseudo[canon.op].op == dec.op);
+		assert(canon.op == riscv_op_nop ? dec.rd == 0 : dec.rd != 0 || (dec.op >= riscv_op_jal && dec.op <= riscv_op_bgeu));
+		rewritten++;
+	}
+
+	static const struct { inst_t inst; opcode_t op; } cases[] = {
+		{ 0x00000013, riscv_op_nop },        /* addi zero, zero, 0 */
+		{ 0x00a00013, riscv_op_nop },        /* addi zero, zero, 10 */
+		{ 0x00b50033, riscv_op_nop },        /* add zero, a0, a1 */
+		{ 0x00500513, riscv_op_li },         /* addi a0, zero, 5 */
+		{ 0x00058513, riscv_op_mv },         /* addi a0, a1, 0 */
+		{ 0x40b00533, riscv_op_neg },        /* sub a0, zero, a1 */
+		{ 0x00008067, riscv_op_ret },        /* jalr zero, 0(ra) */
+		{ 0x00050067, riscv_op_jr },         /* jalr zero, 0(a0) */
+		{ 0x000500e7, riscv_op_jalr },       /* jalr ra, 0(a0) */
+		{ 0x00050463, riscv_op_beqz },       /* beq a0, zero, 8 */
+		{ 0x00b50463, riscv_op_beq },        /* beq a0, a1, 8 */
+		{ 0x0080006f, riscv_op_j },          /* jal zero, 8 */
+		{ 0x00003503, riscv_op_ld },         /* ld a0, 0(zero) */
+		{ 0x00003003, riscv_op_ld },         /* ld zero, 0(zero) */
+	};
+	for (auto &c : cases) {
+		decode dec;
+		decode_inst<decode,rv32,rv64>(dec, c.inst);
+		if (rv32) canonicalize_inst_rv32<decode>(dec);
+		else canonicalize_inst_rv64<decode>(dec);
+		if (rv32 && c.op == riscv_op_ld) continue;
+		assert(dec.op == c.op);
+	}
+	if (rv64) {
+		decode dec;
+		decode_inst<decode,rv32,rv64>(dec, 0x0005851b); /* addiw a0, a1, 0 */
+		canonicalize_inst_rv64<decode>(dec);
+		assert(dec.op == riscv_op_sext_w);
+		decode_inst<decode,rv32,rv64>(dec, 0x0055851b); /* addiw a0, a1, 5 */
+		canonicalize_inst_rv64<decode>(dec);
+		assert(dec.op == riscv_op_addiw);
+	}
+	printf("PASS test_canonicalize %-8s (%zu rewritten)\n", isa, rewritten);
+}
+
+/* first op in a compression or pseudo table whose constraint list holds */
+static int comp_data_op(decode &dec, const riscv_comp_data *comp_data)
+{
+	if (!comp_data) return riscv_op_illegal;
+	for (; comp_data->constraints; comp_data++) {
+		if (constraint_check(dec, comp_data->constraints)) return comp_data->op;
+	}
+	return riscv_op_illegal;
+}
+
+/* compare the generated constraint switches with the constraint tables */
+static void test_constraint_switch(std::vector<inst_t> &insts)
+{
+	size_t comp = 0, pseudo = 0;
+	for (auto inst : insts) {
+		for (int bias = 0; bias < 2; bias++) {
+			/* bias registers towards x8-x15 and small immediates to hit more constraints */
+			decode dec;
+			decode_inst_rv64(dec, bias ? inst & ~0x7f08f800 : inst);
+			assert(decode_pseudo_op(dec) == comp_data_op(dec, riscv_inst_pseudo[dec.op]));
+			assert(compress_op_rv32(dec) == comp_data_op(dec, riscv_inst_comp_rv32[dec.op]));
+			assert(compress_op_rv64(dec) == comp_data_op(dec, riscv_inst_comp_rv64[dec.op]));
+			comp += compress_op_rv64(dec) != riscv_op_illegal;
+			pseudo += decode_pseudo_op(dec) != riscv_op_illegal;
+		}
+	}
+	printf("PASS test_constraint_switch (%zu compressible, %zu pseudo)\n", comp, pseudo);
+}
+
+/* check instruction properties against the operand tables and spot check classes */
+static void test_inst_props()
+{
+	size_t checked = 0;
+	for (int op = 1; op <= riscv_op_li; op++) {
+		if (riscv_inst_decomp_rv32[op] || riscv_inst_decomp_rv64[op] || riscv_inst_depseudo[op].constraints) continue;
+		unsigned src = 0, dst = 0;
+		for (const riscv_operand_data *o = riscv_inst_operand_data[op]; o->type != riscv_type_none; o++) {
+			if (o->operand_name < riscv_operand_name_rd || o->operand_name > riscv_operand_name_frs3) continue;
+			unsigned bit = 1u << (o->operand_name - riscv_operand_name_rd);
+			if (bit & (riscv_reg_rd | riscv_reg_frd)) dst |= bit;
+			else src |= bit;
+		}
+		assert(riscv_inst_props[op].reg_src == src);
+		assert(riscv_inst_props[op].reg_dst == dst);
+		checked++;
+	}
+
+	assert(riscv_inst_props[riscv_op_lb].mem == riscv_mem_load && riscv_inst_props[riscv_op_lb].mem_width == 1);
+	assert(riscv_inst_props[riscv_op_sd].mem == riscv_mem_store && riscv_inst_props[riscv_op_sd].mem_width == 8);
+	assert(riscv_inst_props[riscv_op_amoadd_w].mem == riscv_mem_amo && riscv_inst_props[riscv_op_amoadd_w].mem_width == 4);
+	assert(riscv_inst_props[riscv_op_fmadd_d].latency == riscv_latency_fmadd && riscv_inst_props[riscv_op_fmadd_d].fp);
+	assert(riscv_inst_props[riscv_op_jal].flow == riscv_flow_call);
+	assert(riscv_inst_props[riscv_op_beq].flow == riscv_flow_branch);
+	assert(riscv_inst_props[riscv_op_c_j].flow == riscv_flow_jump);
+	assert(riscv_inst_props[riscv_op_ret].flow == riscv_flow_return);
+	assert(riscv_inst_props[riscv_op_ecall].flow == riscv_flow_trap);
+
+	decode dec;
+	decode_inst_rv64(dec, 0x00b50533); /* add a0, a0, a1 */
+	assert(inst_ireg_src(dec) == ((1u << riscv_ireg_a0) | (1u << riscv_ireg_a1)));
+	assert(inst_ireg_dst(dec) == 1u << riscv_ireg_a0 && inst_freg_src(dec) == 0);
+	decode_inst_rv64(dec, 0x00000013); /* nop */
+	assert(inst_ireg_src(dec) == 0 && inst_ireg_dst(dec) == 0);
+	decode_inst_rv64(dec, 0x1ac5f543); /* fmadd.d fa0, fa1, fa2, ft3 */
+	assert(inst_freg_src(dec) == ((1u << 11) | (1u << 12) | (1u << 3)));
+	assert(inst_freg_dst(dec) == 1u << 10 && inst_ireg_src(dec) == 0);
+	printf("PASS test_inst_props (%zu opcodes)\n", checked);
+}
+
+/* compress and pseudo decode throughput with the constraint tables or switches */
+template <bool generated>
+void bench_compress(std::vector<inst_t> &insts)
+{
+	std::vector<decode> decs(insts.size());
+	for (size_t i = 0; i < insts.size(); i++) {
+		decode_inst_rv64(decs[i], insts[i] & ~0x7f08f800);
+	}
+	const int iters = 16;
+	u64 sum = 0, best = ~0ULL;
+	for (int i = 0; i < iters; i++) {
+		u64 tstart = cpu_cycle_clock();
+		for (auto &dec : decs) {
+			if (generated) {
+				sum += compress_op_rv64(dec) + decode_pseudo_op(dec);
+			} else {
+				sum += comp_data_op(dec, riscv_inst_comp_rv64[dec.op]) +
+					comp_data_op(dec, riscv_inst_pseudo[dec.op]);
+			}
+		}
+		best = std::min(best, cpu_cycle_clock() - tstart);
+	}
+	printf("bench_compress %-6s %6.2f cycles/inst (sum=%llu)\n", generated ? "switch" : "table",
+		double(best) / decs.size(), sum);
+}
+
+/* stream of 16-bit and 32-bit instructions, optionally with 48-bit, 64-bit and illegal lengths */
+static std::vector<u8> sample_text(std::vector<inst_t> &insts, bool irregular)
+{
+	std::vector<u8> text;
+	u64 s = 0x1b873593cc9e2d51ULL;
+	for (auto inst : insts) {
+		u64 r = next_rand(s);
+		if (irregular && (r & 63) == 0) {
+			static const u16 prefix[] = { 0b011111, 0b0111111, 0b1111111 };
+			inst = (r >> 8 & ~u64(0x7f)) | prefix[(r >> 6) % 3];
+		}
+		size_t len = (inst & 0b11) != 0b11 ? 2 : (inst & 0b11100) != 0b11100 ? 4 :
+			(inst & 0b111111) == 0b011111 ? 6 : (inst & 0b1111111) == 0b0111111 ? 8 : 0;
+		if (!irregular && (len == 0 || len > 4)) continue;
+		if (len == 0) len = 2;
+		for (size_t i = 0; i < len; i++) text.push_back(u8(inst >> (i * 8)));
+	}
+	return text;
+}
+
+/* compare multithreaded whole image pre-decode against decoding each slot */
+static void test_predecode(std::vector<u8> &text, const char *name)
+{
+	auto decode_slot = [] (inst_t inst, decode_compact &dec) {
+		decode full_dec;
+		decode_inst_rv64(full_dec, inst);
+		canonicalize_inst_rv64(full_dec);
+		dec = decode_compact(full_dec);
+		return full_dec.op != riscv_op_illegal;
+	};
+
+	/* the padded copy is the reference, pre-decode must not read past the end */
+	std::vector<u8> buf(text), padded(text);
+	padded.resize(padded.size() + 8);
+	addr_t start = addr_t(buf.data()), end = start + (buf.size() & ~size_t(1));
+	inst_predecode predecode;
+	predecode.add(start, end, 0, 4, decode_slot);
+
+	size_t legal = 0;
+	for (addr_t pc = start; pc < end; pc += 2) {
+		addr_t pc_offset;
+		decode_compact ref, dec;
+		inst_t inst = inst_fetch(addr_t(padded.data()) + (pc - start), pc_offset);
+		if (inst == 0 || pc + pc_offset > end || !decode_slot(inst, ref)) {
+			ref = decode_compact();
+			pc_offset = 0;
+		}
+		addr_t len = predecode.lookup(pc, dec);
+		assert(len == pc_offset);
+		assert(memcmp(&dec, &ref, sizeof(dec)) == 0);
+		legal += len != 0;
+	}
+	decode_compact dec;
+	assert(predecode.lookup(start + 1, dec) == 0 && predecode.lookup(end, dec) == 0);
+
+	/* a saved image maps back identically and only for the same slot count */
+	std::string filename = format_string("/tmp/riscv-test-decoder-%d.rvpd", getpid());
+	assert(inst_predecode::save(filename.c_str(), predecode.segs[0]));
+	inst_predecode cached;
+	assert(!cached.load(filename.c_str(), start, end - 2, 0));
+	assert(cached.load(filename.c_str(), start, end, 0));
+	assert(memcmp(cached.segs[0].map, predecode.segs[0].map, predecode.segs[0].map_size) == 0);
+	unlink(filename.c_str());
+	assert(!cached.load(filename.c_str(), start, end, 0));
+
+	predecode.clear();
+	assert(predecode.empty() && predecode.lookup(start, dec) == 0);
+	printf("PASS test_predecode %-10s (%zu legal slots)\n", name, legal);
+}
+
+/* compare batch fetch with and without AVX2 against inst_fetch */
+static void test_fetch_batch(std::vector<u8> &text, const char *name)
+{
+	std::vector<u8> buf(text);
+	buf.resize(buf.size() + 8);
+	addr_t start = addr_t(buf.data()), end = start + text.size();
+
+	std::vector<inst_t> ref_inst;
+	std::vector<addr_t> ref_pc;
+	for (addr_t pc = start; pc < end; ) {
+		inst_t inst;
+		ref_pc.push_back(pc);
+		pc += inst_fetch_one(pc, inst);
+		ref_inst.push_back(inst);
+	}
+
+	bool avx2 = inst_batch_host<>::avx2;
+	for (int host = 0; host < 2; host++) {
+		inst_batch_host<>::avx2 = host && avx2;
+		for (size_t count : { 1, 7, 16, 256 }) {
+			std::vector<inst_t> inst(count);
+			std::vector<u8> len(count);
+			size_t k = 0;
+			for (addr_t pc = start; pc < end; ) {
+				size_t n = inst_fetch_batch(pc, end, inst.data(), len.data(), count);
+				assert(n > 0);
+				addr_t a = ref_pc[k];
+				for (size_t i = 0; i < n; i++, k++) {
+					if (a != ref_pc[k] || inst[i] != ref_inst[k]) {
+						printf("FAIL %s count=%zu offset=%zu inst=0x%016llx/0x%016llx\n", name, count,
+							size_t(ref_pc[k] - start), (unsigned long long)inst[i],
+							(unsigned long long)ref_inst[k]);
+						assert(false);
+					}
+					a += len[i];
+				}
+				assert(a == pc);
+			}
+			assert(k == ref_inst.size());
+		}
+	}
+	inst_batch_host<>::avx2 = avx2;
+	printf("PASS test_fetch_batch %-10s (%zu instructions)\n", name, ref_inst.size());
+}
+
+/* fetch throughput of inst_fetch and the batch fetch */
+template <bool batch>
+void bench_fetch(std::vector<u8> &text)
+{
+	const int iters = 16;
+	const size_t count = 256;
+	inst_t inst[count];
+	u8 len[count];
+	addr_t start = addr_t(text.data()), end = start + text.size() - 8;
+	u64 sum = 0, best = ~0ULL, ninst = 0;
+	for (int i = 0; i < iters; i++) {
+		u64 tstart = cpu_cycle_clock();
+		ninst = 0;
+		for (addr_t pc = start; pc < end; ) {
+			if (batch) {
+				size_t n = inst_fetch_batch(pc, end, inst, len, count);
+				for (size_t j = 0; j < n; j++) sum += inst[j];
+				ninst += n;
+			} else {
+				addr_t pc_offset;
+				sum += inst_fetch(pc, pc_offset);
+				pc += pc_offset;
+				ninst++;
+			}
+		}
+		best = std::min(best, cpu_cycle_clock() - tstart);
+	}
+	printf("bench_fetch  %-6s %6.2f cycles/inst (sum=%llu)\n", batch ? "batch" : "scalar",
+		double(best) / ninst, (unsigned long long)sum);
+}
+
+/* decode throughput of the switch and table decoders */
+template <bool table>
+void bench_decode(std::vector<inst_t> &insts)
+{
+	const int iters = 16;
+	u64 sum = 0, best = ~0ULL;
+	for (int i = 0; i < iters; i++) {
+		u64 tstart = cpu_cycle_clock();
+		for (auto inst : insts) {
+			decode dec;
+			if (table) decode_inst_table<decode,false,true>(dec, inst);
+			else decode_inst<decode,false,true>(dec, inst);
+			sum += dec.op + dec.rd;
+		}
+		best = std::min(best, cpu_cycle_clock() - tstart);
+	}
+	printf("bench_decode %-6s %6.2f cycles/inst (sum=%llu)\n", table ? "table" : "switch",
+		double(best) / insts.size(), sum);
+}
+
+int main()
+{
+	test_rvc_table<true,false,true,true,true,true,false,false>("rv32imac");
+	test_rvc_table<true,false,true,true,true,true,true,true>("rv32gc");
+	test_rvc_table<false,true,true,true,true,true,false,false>("rv64imac");
+	test_rvc_table<false,true,true,true,true,true,true,true>("rv64gc");
+
+	/* decode_inst_rv32/rv64 take the table path for compressed parcels */
+	decode dec;
+	decode_inst_rv64(dec, 0x4501); /* c.li a0, 0 */
+	assert(dec.op == riscv_op_addi && dec.rd == riscv_ireg_a0 && dec.rs1 == riscv_ireg_zero && dec.imm == 0);
+	decode_inst_rv32(dec, 0x00a50533); /* add a0, a0, a0 */
+	assert(dec.op == riscv_op_add && dec.rd == riscv_ireg_a0 && dec.rs1 == riscv_ireg_a0);
+	printf("PASS decode_inst_rv32/rv64\n");
+
+	std::vector<inst_t> insts = sample_insts(1 << 20);
+	test_decode_table<true,false,true,true,true,true,false,false,true>("rv32imac", insts);
+	test_decode_table<true,false,true,true,true,true,true,true,true>("rv32gc", insts);
+	test_decode_table<false,true,true,true,true,true,false,false,true>("rv64imac", insts);
+	test_decode_table<false,true,true,true,true,true,true,true,true>("rv64gc", insts);
+	test_decode_table<false,true,true,false,false,false,false,false,false>("rv64i", insts);
+
+	test_decode_compact<true,false>("rv32gc", insts);
+	test_decode_compact<false,true>("rv64gc", insts);
+
+	test_canonicalize<true,false>("rv32gc", insts);
+	test_canonicalize<false,true>("rv64gc", insts);
+
+	bench_decode<false>(insts);
+	bench_decode<true>(insts);
+
+	test_constraint_switch(insts);
+	test_inst_props();
+	bench_compress<false>(insts);
+	bench_compress<true>(insts);
+
+	inst_batch_host<>::avx2 = RISCV_BATCH_AVX2 && host_cpu::get_instance().caps["AVX2"] != 0;
+	std::vector<u8> text = sample_text(insts, false);
+	test_fetch_batch(text, "regular");
+	std::vector<u8> text_irregular = sample_text(insts, true);
+	test_fetch_batch(text_irregular, "irregular");
+	std::vector<u8> text_random(text.size());
+	u64 s = 0x7f4a7c159e3779b9ULL;
+	for (auto &b : text_random) b = u8(next_rand(s));
+	test_fetch_batch(text_random, "random");
+	test_predecode(text_irregular, "irregular");
+	test_predecode(text_random, "random");
+	text.resize(text.size() + 8);
+	bench_fetch<false>(text);
+	bench_fetch<true>(text);
+
+#if RISCV_IMM_BMI2
+	if (__builtin_cpu_supports("bmi2")) {
+		test_operand_bmi2<operand_jimm20>("jimm20");
+		test_operand_bmi2<operand_simm12>("simm12");
+		test_operand_bmi2<operand_sbimm12>("sbimm12");
+		test_operand_bmi2<operand_cimmsh6>("cimmsh6");
+		test_operand_bmi2<operand_cimmui>("cimmui");
+		test_operand_bmi2<operand_cimmlwsp>("cimmlwsp");
+		test_operand_bmi2<operand_cimmldsp>("cimmldsp");
+		test_operand_bmi2<operand_cimm16sp>("cimm16sp");
+		test_operand_bmi2<operand_cimmj>("cimmj");
+		test_operand_bmi2<operand_cimmb>("cimmb");
+		test_operand_bmi2<operand_cimmsdsp>("cimmsdsp");
+		test_operand_bmi2<operand_cimm4spn>("cimm4spn");
+		test_operand_bmi2<operand_cimmw>("cimmw");
+		test_operand_bmi2<operand_cimmq>("cimmq");
+
+		/* decoding with the pext path enabled matches the portable path */
+		for (auto inst : insts) {
+			decode ref, dec;
+			imm_operand_host<>::bmi2 = false;
+			decode_inst_rv64(ref, inst);
+			imm_operand_host<>::bmi2 = true;
+			decode_inst_rv64(dec, inst);
+			assert(ref.op == dec.op && ref.imm == dec.imm);
+			assert(encode_inst(ref) == encode_inst(dec));
+		}
+		imm_operand_host<>::bmi2 = false;
+		printf("PASS decode_inst_rv64 with bmi2\n");
+	}
+#endif
+
+	return 0;
+}
@@ -9,6 +9,7 @@
 #include <cstdarg>
 #include <csignal>
 #include <cerrno>
+#include <ctime>
 #include <cmath>
 #include <cfenv>
 #include <algorithm>
@@ -16,16 +17,27 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <type_traits>
 #include <vector>
 #include <deque>
 #include <map>
 #include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
 
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <dirent.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+#if defined (__linux__)
+#include <sys/sendfile.h>
+#endif
+#include <poll.h>
 
 #include "riscv-endian.h"
 #include "riscv-types.h"
@@ -48,12 +60,28 @@
 #include "riscv-fpu.h"
 #include "riscv-pte.h"
 #include "riscv-pma.h"
+#include "riscv-pmp.h"
 #include "riscv-memory.h"
 #include "riscv-tlb.h"
 #include "riscv-cache.h"
+#include "riscv-predecode.h"
+#include "riscv-mmio.h"
 #include "riscv-mmu.h"
+#include "riscv-shootdown.h"
+#include "riscv-console.h"
+#include "riscv-uart.h"
+#include "riscv-virtio.h"
+#include "riscv-offload.h"
 #include "riscv-interp.h"
+#include "riscv-abi-syscall.h"
+#include "riscv-time-page.h"
+#include "riscv-syscall-log.h"
+#include "riscv-fd-table.h"
+#include "riscv-syscall-trace.h"
+#include "tlsf.h"
+#include "riscv-hle.h"
 #include "riscv-unknown-abi.h"
+#include "riscv-sbi-proxy.h"
 
 #if defined (ENABLE_GPERFTOOL)
 #include "gperftools/profiler.h"
@@ -310,7 +338,12 @@ struct processor_rv32ima_unit : B
 		decode_inst<T,RV_32,RV_IMA>(dec, inst);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv32<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv32<RV_IMA>(dec, *this, pc_offset);
 	}
 };
@@ -322,11 +355,20 @@ struct processor_rv32imac_unit : B
 		| EXT('I') | EXT('M') | EXT('A') | EXT('C');
 
 	void inst_decode(T &dec, inst_t inst) {
+		if ((inst & 0b11) != 0b11) {
+			decode_inst_rvc<T,RV_32,RV_IMAC>(dec, inst);
+			return;
+		}
 		decode_inst<T,RV_32,RV_IMAC>(dec, inst);
 		decompress_inst_rv32<T>(dec);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv32<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv32<RV_IMAC>(dec, *this, pc_offset);
 	}
 };
@@ -341,7 +383,12 @@ struct processor_rv32imafd_unit : B
 		decode_inst<T,RV_32,RV_IMAFD>(dec, inst);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv32<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv32<RV_IMAFD>(dec, *this, pc_offset);
 	}
 };
@@ -353,11 +400,20 @@ struct processor_rv32imafdc_unit : B
 		| EXT('I') | EXT('M') | EXT('A') | EXT('F') | EXT('D') | EXT('C');
 
 	void inst_decode(T &dec, inst_t inst) {
+		if ((inst & 0b11) != 0b11) {
+			decode_inst_rvc<T,RV_32,RV_IMAFDC>(dec, inst);
+			return;
+		}
 		decode_inst<T,RV_32,RV_IMAFDC>(dec, inst);
 		decompress_inst_rv32<T>(dec);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv32<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv32<RV_IMAFDC>(dec, *this, pc_offset);
 	}
 };
@@ -375,7 +431,12 @@ struct processor_rv64ima_unit : B
 		decode_inst<T,RV_64,RV_IMA>(dec, inst);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv64<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv64<RV_IMA>(dec, *this, pc_offset);
 	}
 };
@@ -387,11 +448,20 @@ struct processor_rv64imac_unit : B
 		| EXT('I') | EXT('M') | EXT('A') | EXT('C');
 
 	void inst_decode(T &dec, inst_t inst) {
+		if ((inst & 0b11) != 0b11) {
+			decode_inst_rvc<T,RV_64,RV_IMAC>(dec, inst);
+			return;
+		}
 		decode_inst<T,RV_64,RV_IMAC>(dec, inst);
 		decompress_inst_rv64<T>(dec);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv64<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv64<RV_IMAC>(dec, *this, pc_offset);
 	}
 };
@@ -406,7 +476,12 @@ struct processor_rv64imafd_unit : B
 		decode_inst<T,RV_64,RV_IMAFD>(dec, inst);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv64<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv64<RV_IMAFD>(dec, *this, pc_offset);
 	}
 };
@@ -418,11 +493,20 @@ struct processor_rv64imafdc_unit : B
 		| EXT('I') | EXT('M') | EXT('A') | EXT('F') | EXT('D') | EXT('C');
 
 	void inst_decode(T &dec, inst_t inst) {
+		if ((inst & 0b11) != 0b11) {
+			decode_inst_rvc<T,RV_64,RV_IMAFDC>(dec, inst);
+			return;
+		}
 		decode_inst<T,RV_64,RV_IMAFDC>(dec, inst);
 		decompress_inst_rv64<T>(dec);
 	}
 
-	addr_t inst_exec(T &dec, addr_t pc_offset) {
+	void inst_canonicalize(T &dec) {
+		canonicalize_inst_rv64<T>(dec);
+	}
+
+	template <typename D>
+	addr_t inst_exec(D &dec, addr_t pc_offset) {
 		return exec_inst_rv64<RV_IMAFDC>(dec, *this, pc_offset);
 	}
 };
@@ -433,9 +517,62 @@ struct processor_rv64imafdc_unit : B
 template <typename P>
 struct processor_proxy : P
 {
+	typedef abi_offload_request<P> offload_request_type;
+	typedef offload_pool<offload_request_type> offload_pool_type;
+
+	time_page clock;                            /* guest clock_gettime and gettimeofday */
+	offload_pool_type *io_pool;                 /* run blocking syscalls on host I/O threads */
+	offload_request_type io_request;            /* outstanding offloaded syscall */
+	bool io_parked_flag;                        /* hart is waiting for io_request */
+	syscall_log sys_log;                        /* syscall record and replay log */
+	fd_table fds;                               /* guest file descriptors */
+	syscall_trace<> *trace;                     /* binary syscall trace */
+	syscall_trace_record trace_pending;         /* trace record of the current syscall */
+	hle_table *hle;                             /* host implementations of libc routines */
+
+	processor_proxy() : io_pool(nullptr), io_request(), io_parked_flag(false),
+		trace(nullptr), trace_pending(), hle(nullptr) {}
+
 	void priv_init() {}
 
-	addr_t inst_csr(typename P::decode_type &dec, int op, int csr, typename P::ux value, addr_t pc_offset)
+	u32 shootdown_drain() { return shootdown_flag_none; }
+
+	void poll_devices() {}
+
+	bool io_parked() { return io_parked_flag; }
+
+	/* fall back to lazy decode if a guest mapping change unmapped or unprotected pre-decoded text */
+	void predecode_check(inst_predecode &predecode)
+	{
+		if (predecode.generation == P::mmu.regions.generation) return;
+		predecode.generation = P::mmu.regions.generation;
+		for (auto &seg : predecode.segs) {
+			if (!P::mmu.regions.has_prot(seg.begin, seg.end, seg.prot)) {
+				if (P::flags & processor_flag_emulator_debug) {
+					debug("predecode : %016" PRIxPTR " - %016" PRIxPTR " changed, lazy decode",
+						seg.begin, seg.end);
+				}
+				predecode.clear();
+				return;
+			}
+		}
+	}
+
+	/* write back a completed offloaded syscall, called at block boundaries */
+	bool io_poll()
+	{
+		if (!io_parked_flag) return false;
+		while (offload_request_type *req = io_pool->complete()) {
+			P::ireg[riscv_ireg_a0] = req->frame.ireg[riscv_ireg_a0];
+			io_parked_flag = false;
+			if (trace) abi_trace_complete(*this);
+		}
+		if (io_parked_flag) io_pool->wait(1000);
+		return io_parked_flag;
+	}
+
+	template <typename D>
+	addr_t inst_csr(D &dec, int op, int csr, typename P::ux value, addr_t pc_offset)
 	{
 		const typename P::ux fflags_mask   = 0x1f;
 		const typename P::ux frm_mask      = 0x3;
@@ -455,7 +592,7 @@ struct processor_proxy : P
 			                         fenv_clearflags(P::fcsr);
 			                         fenv_setrm((P::fcsr >> 5) & 0x7);                            break;
 			case riscv_csr_cycle:    P::get_csr(dec, priv_mode_U, op, csr, P::cycle, value);      break;
-			case riscv_csr_time:     P::time = cpu_cycle_clock();
+			case riscv_csr_time:     P::time = clock.deterministic ? P::instret : cpu_cycle_clock();
 			                         P::get_csr(dec, priv_mode_U, op, csr, P::time, value);       break;
 			case riscv_csr_instret:  P::get_csr(dec, priv_mode_U, op, csr, P::instret, value);    break;
 			case riscv_csr_cycleh:   P::get_csr_hi(dec, priv_mode_U, op, csr, P::cycle, value);   break;
@@ -466,9 +603,11 @@ struct processor_proxy : P
 		return pc_offset;
 	}
 
-	addr_t inst_priv(typename P::decode_type &dec, addr_t pc_offset) {
+	template <typename D>
+	addr_t inst_priv(D &dec, addr_t pc_offset) {
 		switch (dec.op) {
 			case riscv_op_ecall:  proxy_syscall(*this); return pc_offset;
+			case riscv_op_fence_i: return pc_offset;
 			case riscv_op_csrrw:  return inst_csr(dec, csr_rw, dec.imm, P::ireg[dec.rs1], pc_offset);
 			case riscv_op_csrrs:  return inst_csr(dec, csr_rs, dec.imm, P::ireg[dec.rs1], pc_offset);
 			case riscv_op_csrrc:  return inst_csr(dec, csr_rc, dec.imm, P::ireg[dec.rs1], pc_offset);
@@ -477,6 +616,7 @@ struct processor_proxy : P
 			case riscv_op_csrrci: return inst_csr(dec, csr_rc, dec.imm, dec.rs1, pc_offset);
 			default: break;
 		}
+		if (hle) return abi_hle_trap(*this);
 		return 0; /* illegal instruction */
 	}
 };
@@ -487,11 +627,59 @@ struct processor_proxy : P
 template <typename P>
 struct processor_privileged : P
 {
+	typedef shootdown<typename P::ux> shootdown_type;
+
+	shootdown_type *shootdown_domain = nullptr; /* shared by all harts */
+	bool sbi_proxy = false;                     /* service S-mode ecalls in the emulator */
+	typename P::ux sbi_config = 0;              /* config string address returned by sbi_get_config */
+	console_writer<> console;                   /* buffered console output */
+	console_reader<> console_input;             /* console input polled at block boundaries */
+	bool uart_attached = false;                 /* console UART on the MMIO bus */
+
 	void priv_init()
 	{
 		P::misa = P::misa_default; // set initial value for misa register
 	}
 
+	/* apply invalidations queued by remote harts, called at block boundaries */
+	u32 shootdown_drain()
+	{
+		if (!shootdown_domain) return shootdown_flag_none;
+		u32 flags = shootdown_domain->queue(P::mhartid).drain(P::pdid, P::mmu.l1_itlb, P::mmu.l1_dtlb);
+		if (flags & shootdown_flag_fence_i) {
+			P::mmu.l1_itlb.flush(P::pdid);
+		}
+		return flags;
+	}
+
+	/* poll host device input and drive the external interrupt line, called at block boundaries */
+	void poll_devices()
+	{
+		if (sbi_proxy || uart_attached) console_input.poll();
+		if (!P::mmu.mmio.empty()) P::mip.ip.meip = P::mmu.mmio.irq_pending();
+	}
+
+	bool io_parked() { return false; }
+
+	bool io_poll() { return false; }
+
+	/* text is only pre-decoded for the proxy emulator */
+	void predecode_check(inst_predecode &predecode) {}
+
+	template <typename D>
+	addr_t inst_sfence_vm(D &dec, addr_t pc_offset)
+	{
+		typename P::ux asid = P::sptbr >> P::mmu_type::tlb_type::ppn_bits;
+		if (dec.rs1 == 0) {
+			P::mmu.l1_itlb.flush(P::pdid, asid);
+			P::mmu.l1_dtlb.flush(P::pdid, asid);
+		} else {
+			P::mmu.l1_itlb.flush(P::pdid, asid, P::ireg[dec.rs1]);
+			P::mmu.l1_dtlb.flush(P::pdid, asid, P::ireg[dec.rs1]);
+		}
+		return pc_offset;
+	}
+
 	void print_csr_registers()
 	{
 		P::print_csr_registers();
@@ -522,7 +710,8 @@ struct processor_privileged : P
 		                 format_reg("mdbound",   P::mdbound).c_str());
 	}
 
-	addr_t inst_csr(typename P::decode_type &dec, int op, int csr, typename P::ux value, addr_t pc_offset)
+	template <typename D>
+	addr_t inst_csr(D &dec, int op, int csr, typename P::ux value, addr_t pc_offset)
 	{
 		const typename P::ux fflags_mask   = 0x1f;
 		const typename P::ux frm_mask      = 0x3;
@@ -583,20 +772,86 @@ struct processor_privileged : P
 			case riscv_csr_scause:   P::set_csr(dec, P::mode, op, csr, P::scause, value);     break;
 			case riscv_csr_sbadaddr: P::set_csr(dec, P::mode, op, csr, P::sbadaddr, value);   break;
 			case riscv_csr_sptbr:    P::set_csr(dec, P::mode, op, csr, P::sptbr, value);      break;
+			case riscv_csr_pmpcfg0:
+			case riscv_csr_pmpcfg1:
+			case riscv_csr_pmpcfg2:
+			case riscv_csr_pmpcfg3:  return inst_csr_pmpcfg(dec, op, csr, value, pc_offset);
+			case riscv_csr_pmpaddr0:
+			case riscv_csr_pmpaddr1:
+			case riscv_csr_pmpaddr2:
+			case riscv_csr_pmpaddr3:
+			case riscv_csr_pmpaddr4:
+			case riscv_csr_pmpaddr5:
+			case riscv_csr_pmpaddr6:
+			case riscv_csr_pmpaddr7:
+			case riscv_csr_pmpaddr8:
+			case riscv_csr_pmpaddr9:
+			case riscv_csr_pmpaddr10:
+			case riscv_csr_pmpaddr11:
+			case riscv_csr_pmpaddr12:
+			case riscv_csr_pmpaddr13:
+			case riscv_csr_pmpaddr14:
+			case riscv_csr_pmpaddr15: return inst_csr_pmpaddr(dec, op, csr, value, pc_offset);
 			default: return 0; /* illegal instruction */
 		}
 		return pc_offset;
 	}
 
-	addr_t inst_priv(typename P::decode_type &dec, addr_t pc_offset) {
+	/* PMP page permissions are cached in the TLBs and page cache so they are flushed when PMP changes */
+	void pmp_changed()
+	{
+		P::mmu.l1_itlb.flush(P::pdid);
+		P::mmu.l1_dtlb.flush(P::pdid);
+		P::mmu.l1_pmp.flush();
+	}
+
+	template <typename D>
+	addr_t inst_csr_pmpcfg(D &dec, int op, int csr, typename P::ux value, addr_t pc_offset)
+	{
+		const size_t n = csr - riscv_csr_pmpcfg0;
+		if (P::xlen == 64 && (n & 1)) return 0; /* pmpcfg1 and pmpcfg3 are RV32 only */
+
+		/* fields of locked entries are not writable */
+		typename P::ux old_cfg = P::pmpcfg[n], locked_mask = 0;
+		for (size_t i = 0; i < sizeof(typename P::ux); i++) {
+			if ((old_cfg >> (i << 3)) & pmp_cfg_L) locked_mask |= typename P::ux(0xff) << (i << 3);
+		}
+		P::set_csr(dec, P::mode, op, csr, P::pmpcfg[n], value);
+		P::pmpcfg[n] = (P::pmpcfg[n] & ~locked_mask) | (old_cfg & locked_mask);
+		if (P::pmpcfg[n] != old_cfg) pmp_changed();
+		return pc_offset;
+	}
+
+	template <typename D>
+	addr_t inst_csr_pmpaddr(D &dec, int op, int csr, typename P::ux value, addr_t pc_offset)
+	{
+		const size_t n = csr - riscv_csr_pmpaddr0;
+
+		/* a locked entry, or the base of a locked TOR entry, is not writable */
+		u8 next_cfg = n + 1 < pmp_entries ? pmp_cfg(P::pmpcfg, n + 1) : 0;
+		bool locked = (pmp_cfg(P::pmpcfg, n) & pmp_cfg_L) || ((next_cfg & pmp_cfg_L) &&
+			((next_cfg & pmp_cfg_A_mask) >> pmp_cfg_A_shift) == pmp_match_tor);
+		typename P::ux old_addr = P::pmpaddr[n];
+		P::set_csr(dec, P::mode, op, csr, P::pmpaddr[n], value);
+		if (locked) P::pmpaddr[n] = old_addr;
+		if (P::pmpaddr[n] != old_addr) pmp_changed();
+		return pc_offset;
+	}
+
+	template <typename D>
+	addr_t inst_priv(D &dec, addr_t pc_offset) {
 		switch (dec.op) {
-			case riscv_op_ecall:     return 0; break;
+			case riscv_op_ecall:     if (sbi_proxy && P::mode == priv_mode_S) {
+			                             proxy_sbi(*this);
+			                             return pc_offset;
+			                         }
+			                         return 0; break;
 			case riscv_op_ebreak:    return 0; break;
 			case riscv_op_uret:      return 0; break;
 			case riscv_op_sret:      return 0; break;
 			case riscv_op_hret:      return 0; break;
 			case riscv_op_mret:      return 0; break;
-			case riscv_op_sfence_vm: return 0; break;
+			case riscv_op_sfence_vm: return inst_sfence_vm(dec, pc_offset);
 			case riscv_op_wfi:       return 0; break;
 			case riscv_op_csrrw:     return inst_csr(dec, csr_rw, dec.imm, P::ireg[dec.rs1], pc_offset);
 			case riscv_op_csrrs:     return inst_csr(dec, csr_rs, dec.imm, P::ireg[dec.rs1], pc_offset);
@@ -628,10 +883,26 @@ struct processor_stepper : processor_fault, P
 	struct riscv_inst_cache_ent
 	{
 		inst_t inst;
-		typename P::decode_type dec;
+		decode_compact dec;
+
+		riscv_inst_cache_ent() : inst(0) {}
 	};
 
 	riscv_inst_cache_ent inst_cache[inst_cache_size];
+	inst_predecode predecode;                   /* pre-decoded text, empty for lazy decode */
+
+	void inst_cache_flush()
+	{
+		for (auto &ent : inst_cache) ent = riscv_inst_cache_ent();
+	}
+
+	/* the log needs the full decode, rm, aq, rl, pred and succ are not cached */
+	void print_log(inst_t inst)
+	{
+		typename P::decode_type dec;
+		P::inst_decode(dec, inst);
+		P::print_log(dec, inst);
+	}
 
 	static void signal_handler(int signum, siginfo_t *info, void *)
 	{
@@ -697,31 +968,69 @@ struct processor_stepper : processor_fault, P
 		P::priv_init();
 	}
 
+	/* pre-decode the text in [begin, end) with up to num_threads threads */
+	void predecode_text(addr_t begin, addr_t end, int prot, size_t num_threads)
+	{
+		predecode.add(begin, end, prot, num_threads, [this] (inst_t inst, decode_compact &dec) {
+			typename P::decode_type full_dec;
+			P::inst_decode(full_dec, inst);
+			P::inst_canonicalize(full_dec);
+			dec = decode_compact(full_dec);
+			return full_dec.op != riscv_op_illegal;
+		});
+	}
+
+	/* privileged and system instructions, fence.i and mapping changes end pre-decode */
+	addr_t inst_priv(decode_compact &dec, addr_t pc_offset)
+	{
+		addr_t new_offset = P::inst_priv(dec, pc_offset);
+		if (!predecode.empty()) {
+			if (dec.op == riscv_op_fence_i) predecode.clear();
+			else P::predecode_check(predecode);
+		}
+		return new_offset;
+	}
+
 	bool step(size_t count)
 	{
-		typename P::decode_type dec;
+		decode_compact dec;
 		size_t i = 0;
-		inst_t inst;
+		inst_t inst = 0;
 		addr_t pc_offset, new_offset;
 		P::time = cpu_cycle_clock();
+		if (P::shootdown_drain() & shootdown_flag_fence_i) {
+			inst_cache_flush();
+			predecode.clear();
+		}
+		P::poll_devices();
+		if (P::io_poll()) return true; /* parked on an offloaded syscall */
 		while (i < count) {
-			inst = P::mmu.inst_fetch(P::pc, pc_offset);
-			inst_t inst_cache_key = inst % inst_cache_size;
-			if (inst_cache[inst_cache_key].inst == inst) {
-				dec = inst_cache[inst_cache_key].dec;
+			if ((pc_offset = predecode.lookup(P::pc, dec))) {
+				if (P::log_flags) inst = P::mmu.inst_fetch(P::pc, new_offset);
 			} else {
-				P::inst_decode(dec, inst);
-				inst_cache[inst_cache_key].inst = inst;
-				inst_cache[inst_cache_key].dec = dec;
+				inst = P::mmu.inst_fetch(P::pc, pc_offset);
+				inst_t inst_cache_key = inst % inst_cache_size;
+				if (inst_cache[inst_cache_key].inst == inst) {
+					dec = inst_cache[inst_cache_key].dec;
+				} else {
+					typename P::decode_type full_dec;
+					P::inst_decode(full_dec, inst);
+					P::inst_canonicalize(full_dec);
+					dec = decode_compact(full_dec);
+					inst_cache[inst_cache_key].inst = inst;
+					inst_cache[inst_cache_key].dec = dec;
+				}
 			}
 			if ((new_offset = P::inst_exec(dec, pc_offset)) ||
-				(new_offset = P::inst_priv(dec, pc_offset)))
+				(new_offset = inst_priv(dec, pc_offset)))
 			{
-				if (P::log_flags) P::print_log(dec, inst);
+				if (P::log_flags) print_log(inst);
 				if (P::log_flags & reg_log_csr) P::print_csr_registers();
 				P::pc += new_offset;
 				P::cycle++;
 				P::instret++;
+				if (P::io_parked()) break;
+				i++;
 				continue;
 			}
 			fault(SIGILL, P::pc);
@@ -773,19 +1082,42 @@ struct riscv_emulator
 
 	static const size_t stack_top =  0x78000000; // 1920 MiB
 	static const size_t stack_size = 0x01000000; //   16 MiB
+	static const size_t hle_heap_chunk = 0x04000000; // 64 MiB
+	static const size_t predecode_cache_max = 0x10000000; // 256 MiB
 
 	elf_file elf;
 	std::string filename;
+	std::vector<std::string> guest_args;
+	std::vector<std::string> guest_env;
+	size_t stack_prefault = 0;
+	bool hle_enable = false;
+	bool hle_verify = false;
+	bool hle_malloc = false;
+	u8 aux_random[16];
 	int log_flags = 0;
 	bool priv_mode = false;
+	bool sbi_proxy = false;
+	bool uart = false;
+	std::string virtio_blk_image;
 	bool memory_debug = false;
 	bool emulator_debug = false;
 	bool help_or_error = false;
 	uint64_t initial_seed = 0;
+	uint64_t instret_time = 0;
+	size_t io_threads = 0;
+	bool predecode = false;
+	std::string predecode_cache;
+	std::string record_file;
+	std::string trace_file;
+	fd_preload preload;
+	std::string replay_file;
 	int ext = rv_isa_imafdc;
 	host_cpu &cpu;
 
-	riscv_emulator() : cpu(host_cpu::get_instance()) {}
+	riscv_emulator() : cpu(host_cpu::get_instance())
+	{
+		imm_operand_host<>::bmi2 = cpu.caps["BMI2"] != 0;
+	}
 
 	static rv_isa decode_isa_ext(std::string isa_ext)
 	{
@@ -824,8 +1156,21 @@ struct riscv_emulator
 			panic("map_stack: error: mmap: %s", strerror(errno));
 		}
 
-		/* keep track of the mapped segment and set the stack_top */
-		proc.mmu.segments.push_back(std::pair<void*,size_t>((void*)(stack_top - stack_size), stack_size));
+		/* prefault the top of the stack in one call rather than a fault per page */
+	#if defined (MAP_POPULATE)
+		if (stack_prefault > 0) {
+			addr_t len = std::min(addr_t(round_up(stack_prefault, page_size)), stack_size);
+			addr = mmap((void*)(stack_top - len), len, PROT_READ | PROT_WRITE,
+				MAP_FIXED | MAP_ANONYMOUS | MAP_PRIVATE | MAP_POPULATE, -1, 0);
+			if (addr == MAP_FAILED) {
+				panic("map_stack: error: mmap: %s", strerror(errno));
+			}
+		}
+	#endif
+
+		/* keep track of the mapped segment, guest mmap regions go below the stack */
+		proc.mmu.regions.add(stack_top - stack_size, stack_top, PROT_READ | PROT_WRITE);
+		proc.mmu.mmap_top = stack_top - stack_size;
 		proc.ireg[riscv_ireg_sp] = stack_top - 0x8;
 
 		if (emulator_debug) {
@@ -834,6 +1179,174 @@ struct riscv_emulator
 		}
 	}
 
+	/* Guest address of the program headers for AT_PHDR */
+	addr_t phdr_addr()
+	{
+		for (auto &phdr : elf.phdrs) {
+			if (phdr.p_type == PT_PHDR) return addr_t(phdr.p_vaddr);
+		}
+		for (auto &phdr : elf.phdrs) {
+			if (phdr.p_type == PT_LOAD && phdr.p_offset <= elf.ehdr.e_phoff &&
+				elf.ehdr.e_phoff < phdr.p_offset + phdr.p_filesz)
+			{
+				return addr_t(phdr.p_vaddr + elf.ehdr.e_phoff - phdr.p_offset);
+			}
+		}
+		return 0;
+	}
+
+	/* Linux hwcap bits are the single letter ISA extensions */
+	u64 isa_hwcap()
+	{
+		u64 hwcap = (1ULL << ('I' - 'A')) | (1ULL << ('M' - 'A')) | (1ULL << ('A' - 'A'));
+		if (ext == rv_isa_imafd || ext == rv_isa_imafdc) {
+			hwcap |= (1ULL << ('F' - 'A')) | (1ULL << ('D' - 'A'));
+		}
+		if (ext == rv_isa_imac || ext == rv_isa_imafdc) {
+			hwcap |= (1ULL << ('C' - 'A'));
+		}
+		return hwcap;
+	}
+
+	/* Patch known libc routines to trap into their host implementations */
+	template <typename P>
+	void init_hle(P &proc, hle_table &hle)
+	{
+		hle.verify = hle_verify;
+		proc.hle = &hle;
+		if (hle_malloc && !abi_hle_heap_init(proc, hle_heap_chunk)) {
+			panic("hle: error: can't create the guest heap");
+		}
+		for (int fn = 0; fn < hle_fn_count; fn++) {
+			if (hle_fn_is_alloc(fn) ? !hle_malloc : !hle_enable) continue;
+			const Elf64_Sym *sym = elf.sym_by_name(hle_fn_name(fn));
+			if (!sym || sym->st_shndx == SHN_UNDEF || sym->st_value == 0) continue;
+			addr_t pc = addr_t(sym->st_value);
+			auto ri = proc.mmu.regions.regions.upper_bound(pc);
+			if (ELF64_ST_TYPE(sym->st_info) != STT_FUNC ||
+				ri == proc.mmu.regions.regions.end() || ri->second.begin > pc ||
+				!(ri->second.prot & PROT_EXEC))
+			{
+				/* a guest allocator entry left in place could free host heap pointers */
+				if (hle_fn_is_alloc(fn)) {
+					panic("hle: error: can't replace %s", hle_fn_name(fn));
+				}
+				continue;
+			}
+			if (!hle.patch(hle_fn(fn), pc, ri->second.prot)) {
+				panic("hle: error: mprotect: %s", strerror(errno));
+			}
+			if (emulator_debug) {
+				debug("hle    %-8s: %016" PRIxPTR, hle_fn_name(fn), pc);
+			}
+		}
+
+		/* verify mode returns through a trap page below the stack */
+		if (hle.verify) {
+			addr_t trap = proc.mmu.regions.find_free(page_size, proc.mmu.mmap_top, page_size);
+			void *addr = trap ? mmap((void*)trap, page_size, PROT_READ | PROT_WRITE,
+				MAP_FIXED | MAP_ANONYMOUS | MAP_PRIVATE, -1, 0) : MAP_FAILED;
+			if (addr == MAP_FAILED) {
+				panic("hle: error: mmap: %s", strerror(errno));
+			}
+			mprotect(addr, page_size, PROT_READ | PROT_EXEC);
+			proc.mmu.regions.add(trap, trap + page_size, PROT_READ | PROT_EXEC);
+			hle.ret_trap = trap;
+		}
+	}
+
+	/* Cache file for the decode of [begin, end) by this emulator build and ISA */
+	template <typename P>
+	std::string predecode_cache_file(P &proc, addr_t begin, addr_t end)
+	{
+		sha512_ctx_t sha512;
+		u8 hash[SHA512_OUTPUT_BYTES];
+		predecode_segment seg = inst_predecode::segment(begin, end, 0);
+		std::string salt = format_string("riscv-test-emulate predecode=%d meta=%016llx compact=%zu misa=%016llx",
+			int(inst_predecode::version), riscv_meta_digest,
+			sizeof(decode_compact), (unsigned long long)proc.misa_default);
+		sha512_init(&sha512);
+		sha512_update(&sha512, (const u8*)salt.c_str(), salt.size() + 1);
+		sha512_update(&sha512, (const u8*)seg.begin, seg.end - seg.begin);
+		sha512_final(&sha512, hash);
+		std::string filename = predecode_cache + "/";
+		for (size_t i = 0; i < SHA512_OUTPUT_BYTES; i++) {
+			filename += format_string("%02x", hash[i]);
+		}
+		return filename + inst_predecode::cache_suffix();
+	}
+
+	/* Pre-decode the read-only executable ELF segments, or map them from the cache */
+	template <typename P>
+	void predecode_text(P &proc)
+	{
+		u64 tstart = cpu_cycle_clock();
+		size_t num_threads = std::max(1U, std::thread::hardware_concurrency());
+		if (predecode_cache.size() > 0 && mkdir(predecode_cache.c_str(), 0755) < 0 && errno != EEXIST) {
+			panic("predecode: error: mkdir: %s: %s", predecode_cache.c_str(), strerror(errno));
+		}
+		for (auto &phdr : elf.phdrs) {
+			if (phdr.p_type != PT_LOAD || (phdr.p_flags & (PF_X | PF_W)) != PF_X) continue;
+			addr_t begin = addr_t(phdr.p_vaddr), end = addr_t(phdr.p_vaddr + phdr.p_filesz);
+			int prot = elf_p_flags_mmap(phdr.p_flags);
+			std::string cache_file;
+			if (predecode_cache.size() > 0) {
+				cache_file = predecode_cache_file(proc, begin, end);
+				if (proc.predecode.load(cache_file.c_str(), begin, end, prot)) {
+					if (emulator_debug) debug("predecode : %s hit", cache_file.c_str());
+					continue;
+				}
+			}
+			proc.predecode_text(begin, end, prot, num_threads);
+			if (cache_file.size() > 0) {
+				bool saved = inst_predecode::save(cache_file.c_str(), proc.predecode.segs.back());
+				if (emulator_debug) debug("predecode : %s %s", cache_file.c_str(), saved ? "saved" : "not saved");
+				if (saved) inst_predecode::evict(predecode_cache.c_str(), predecode_cache_max);
+			}
+		}
+		proc.predecode.generation = proc.mmu.regions.generation;
+
+		if (emulator_debug) {
+			for (auto &seg : proc.predecode.segs) {
+				debug("predecode : %016" PRIxPTR " - %016" PRIxPTR " %zu slots",
+					seg.begin, seg.end, seg.slots());
+			}
+			debug("predecode : %llu cycles, %zu threads",
+				(unsigned long long)(cpu_cycle_clock() - tstart), num_threads);
+		}
+	}
+
+	/* Build the initial process stack with argv, envp and auxv */
+	template <typename P>
+	void init_stack(P &proc, addr_t stack_top, addr_t stack_size)
+	{
+		std::vector<std::string> args = guest_args;
+		args.insert(args.begin(), filename);
+		abi_auxv auxv = {
+			{ abi_at_phdr, phdr_addr() },
+			{ abi_at_phent, elf.ehdr.e_phentsize },
+			{ abi_at_phnum, elf.ehdr.e_phnum },
+			{ abi_at_pagesz, page_size },
+			{ abi_at_entry, elf.ehdr.e_entry },
+			{ abi_at_uid, 0 },
+			{ abi_at_euid, 0 },
+			{ abi_at_gid, 0 },
+			{ abi_at_egid, 0 },
+			{ abi_at_hwcap, isa_hwcap() },
+			{ abi_at_clktck, 100 },
+			{ abi_at_secure, 0 },
+		};
+		if (!abi_init_stack(proc, stack_top, stack_size / 4, args, guest_env, auxv, aux_random)) {
+			panic("init_stack: error: arguments and environment exceed %zu bytes",
+				size_t(stack_size / 4));
+		}
+
+		if (emulator_debug) {
+			debug("stack  sp : %016" PRIxPTR " argc=%zu envc=%zu",
+				addr_t(proc.ireg[riscv_ireg_sp].r.xu.val), args.size(), guest_env.size());
+		}
+	}
+
 	/* Map ELF load segments into mmu address space */
 	template <typename P>
 	void map_load_segment_mmu(P &proc, const char* filename, Elf64_Phdr &phdr)
@@ -876,7 +1389,7 @@ struct riscv_emulator
 		}
 
 		/* keep track of the mapped segment and set the heap_end */
-		proc.mmu.segments.push_back(std::pair<void*,size_t>((void*)phdr.p_vaddr, phdr.p_memsz));
+		proc.mmu.regions.add(phdr.p_vaddr, phdr.p_vaddr + phdr.p_memsz, elf_p_flags_mmap(phdr.p_flags));
 		addr_t seg_end = addr_t(phdr.p_vaddr + phdr.p_memsz);
 		if (proc.mmu.heap_begin < seg_end) proc.mmu.heap_begin = proc.mmu.heap_end = seg_end;
 
@@ -903,6 +1416,15 @@ struct riscv_emulator
 			{ "-p", "--privileged", cmdline_arg_type_none,
 				"Privileged ISA Emulation",
 				[&](std::string s) { return (priv_mode = true); } },
+			{ "-S", "--sbi-proxy", cmdline_arg_type_none,
+				"Service Supervisor Binary Interface calls in the emulator",
+				[&](std::string s) { return (sbi_proxy = true); } },
+			{ "-u", "--uart", cmdline_arg_type_none,
+				"Attach a 16550 console UART at 0x40000000 (privileged mode)",
+				[&](std::string s) { return (uart = true); } },
+			{ "-b", "--virtio-blk", cmdline_arg_type_string,
+				"Attach a virtio-blk disk image at 0x40001000 (privileged mode)",
+				[&](std::string s) { virtio_blk_image = s; return true; } },
 			{ "-c", "--log-csr-registers", cmdline_arg_type_none,
 				"Log Control and Status Registers",
 				[&](std::string s) { return (log_flags |= reg_log_csr); } },
@@ -924,6 +1446,48 @@ struct riscv_emulator
 			{ "-o", "--log-operands", cmdline_arg_type_none,
 				"Log Instructions and operands",
 				[&](std::string s) { return (log_flags |= (reg_log_inst | reg_log_operands)); } },
+			{ "-t", "--instret-time", cmdline_arg_type_string,
+				"Deterministic guest time from instret (nanoseconds per instruction)",
+				[&](std::string s) { instret_time = strtoull(s.c_str(), nullptr, 10); return instret_time > 0; } },
+			{ "-a", "--async-io", cmdline_arg_type_string,
+				"Run blocking syscalls on host I/O threads (off by default, slower with one hart)",
+				[&](std::string s) { io_threads = strtoull(s.c_str(), nullptr, 10); return io_threads > 0; } },
+			{ "-R", "--record-syscalls", cmdline_arg_type_string,
+				"Record syscall results to a log file",
+				[&](std::string s) { record_file = s; return true; } },
+			{ "-P", "--replay-syscalls", cmdline_arg_type_string,
+				"Replay syscall results from a log file without host calls",
+				[&](std::string s) { replay_file = s; return true; } },
+			{ "-L", "--preload", cmdline_arg_type_string,
+				"Preload a read-only guest input file into memory",
+				[&](std::string s) {
+					if (!preload.add(s.c_str())) panic("preload: %s: %s", s.c_str(), strerror(errno));
+					return true;
+				} },
+			{ "-T", "--trace-syscalls", cmdline_arg_type_string,
+				"Write a binary syscall trace (decode with riscv-parse-trace)",
+				[&](std::string s) { trace_file = s; return true; } },
+			{ "-E", "--env", cmdline_arg_type_string,
+				"Add a guest environment variable (name=value)",
+				[&](std::string s) { guest_env.push_back(s); return true; } },
+			{ "-e", "--predecode", cmdline_arg_type_none,
+				"Decode static executable segments at load time",
+				[&](std::string s) { return (predecode = true); } },
+			{ "-C", "--predecode-cache", cmdline_arg_type_string,
+				"Map pre-decoded segments from a cache directory, implies --predecode",
+				[&](std::string s) { predecode_cache = s; return (predecode = true); } },
+			{ "-K", "--stack-prefault", cmdline_arg_type_string,
+				"Prefault the top of the guest stack (KiB)",
+				[&](std::string s) { stack_prefault = strtoull(s.c_str(), nullptr, 10) << 10; return stack_prefault > 0; } },
+			{ "-H", "--hle", cmdline_arg_type_none,
+				"Run libc memory and string routines on the host",
+				[&](std::string s) { return (hle_enable = true); } },
+			{ "-V", "--hle-verify", cmdline_arg_type_none,
+				"Check host libc routines against the interpreted guest routines",
+				[&](std::string s) { return (hle_enable = hle_verify = true); } },
+			{ "-M", "--hle-malloc", cmdline_arg_type_none,
+				"Serve the guest malloc family from a host TLSF allocator",
+				[&](std::string s) { return (hle_malloc = true); } },
 			{ "-s", "--seed", cmdline_arg_type_string,
 				"Random seed",
 				[&](std::string s) { initial_seed = strtoull(s.c_str(), nullptr, 10); return true; } },
@@ -936,26 +1500,28 @@ struct riscv_emulator
 		auto result = cmdline_option::process_options(options, argc, argv);
 		if (!result.second) {
 			help_or_error = true;
-		} else if (result.first.size() != 1) {
+		} else if (result.first.size() < 1) {
 			printf("%s: wrong number of arguments\n", argv[0]);
 			help_or_error = true;
 		}
 
 		if (help_or_error) {
-			printf("usage: %s [<options>] <elf_file>\n", argv[0]);
+			printf("usage: %s [<options>] <elf_file> [<guest_args>]\n", argv[0]);
 			cmdline_option::print_options(options);
 			exit(9);
 		}
 
+		/* arguments after the ELF file are passed to the guest */
 		filename = result.first[0];
+		guest_args.assign(result.first.begin() + 1, result.first.end());
 
 		/* print process information */
 		if (memory_debug) {
 			memory_info(argc, argv);
 		}
 
-		/* load ELF (headers only) */
-		elf.load(filename, true);
+		/* load ELF (headers only unless symbols are needed for HLE) */
+		elf.load(filename, !(hle_enable || hle_malloc));
 	}
 
 	/* print approximate location of host text, heap and stack of our user process */
@@ -1008,6 +1574,12 @@ struct riscv_emulator
 			proc.ireg[i].r.xu.val = *(u64*)(random + (rand_bytes & (SHA512_OUTPUT_BYTES - 1)));
 			rand_bytes += 8;
 		}
+
+		// AT_RANDOM bytes for the guest from the next hash of the seed
+		sha512_init(&sha512);
+		sha512_update(&sha512, seed, SHA512_OUTPUT_BYTES);
+		sha512_final(&sha512, random);
+		memcpy(aux_random, random, sizeof(aux_random));
 	}
 
 	/* Start the execuatable with the given privileged processor template */
@@ -1023,6 +1595,11 @@ struct riscv_emulator
 		proc.log_flags = log_flags;
 		proc.pc = elf.ehdr.e_entry;
 
+		/* connect the hart to the shootdown domain and optional SBI proxy */
+		typename P::shootdown_type shootdown_domain;
+		proc.shootdown_domain = &shootdown_domain;
+		proc.sbi_proxy = sbi_proxy;
+
 		/* randomise integer register state with 512 bits of entropy */
 		seed_registers(proc, 512);
 
@@ -1035,7 +1612,32 @@ struct riscv_emulator
 		}
 
 		/* Add 1GB RAM to the mmu (make this a command line option) */
-		proc.mmu.mem.add_ram(0x0, /*1GB*/0x40000000ULL);
+		const u64 ram_size = /*1GB*/0x40000000ULL;
+		proc.mmu.mem.add_ram(0x0, ram_size);
+
+		/* Place the SBI config string in the last page of RAM */
+		if (sbi_proxy && !sbi_install_config(proc, ram_size - page_size, 0x0, ram_size)) {
+			panic("sbi: error: can't install the config string");
+		}
+
+		/* Attach memory mapped devices above RAM */
+		typedef typename P::ux ux;
+		typedef uart_16550<ux> uart_type;
+		uart_type console_uart(ux(ram_size), proc.console, proc.console_input);
+		mmio_device_adapter<ux,uart_type> uart_mmio(console_uart, uart_size);
+		if (uart) {
+			proc.mmu.mmio.add(&uart_mmio);
+			proc.uart_attached = true;
+		}
+		typedef virtio_blk<ux> virtio_blk_type;
+		virtio_blk_type blk(proc.mmu.mem, ux(ram_size + 0x1000));
+		mmio_device_adapter<ux,virtio_blk_type> blk_mmio(blk, virtio_mmio_size);
+		if (virtio_blk_image.size() > 0) {
+			if (!blk.open_image(virtio_blk_image.c_str(), false)) {
+				panic("virtio-blk: error: can't open %s", virtio_blk_image.c_str());
+			}
+			proc.mmu.mmio.add(&blk_mmio);
+		}
 
 #if defined (ENABLE_GPERFTOOL)
 		ProfilerStart("test-emulate.out");
@@ -1065,6 +1667,20 @@ struct riscv_emulator
 		proc.log_flags = log_flags;
 		proc.pc = elf.ehdr.e_entry;
 
+		/* guest file descriptors, preloaded files are shared between guests */
+		proc.fds.preload = &preload;
+
+		/* open the syscall log, the register seed is part of the log */
+		if (record_file.size() > 0) {
+			while (!initial_seed) {
+				initial_seed = (((u64)cpu.get_random_seed()) << 32) | (u64)cpu.get_random_seed();
+			}
+			proc.sys_log.open_record(record_file.c_str(), initial_seed);
+		} else if (replay_file.size() > 0) {
+			proc.sys_log.open_replay(replay_file.c_str());
+			initial_seed = proc.sys_log.seed;
+		}
+
 		/* randomise integer register state with 512 bits of entropy */
 		seed_registers(proc, 512);
 
@@ -1076,8 +1692,50 @@ struct riscv_emulator
 			}
 		}
 
-		/* Map a stack and set the stack pointer */
+		/* Map a stack and build the initial process stack */
 		map_stack(proc, stack_top, stack_size);
+		init_stack(proc, stack_top, stack_size);
+
+		/* Replace libc routines with host implementations */
+		hle_table hle;
+		if (hle_enable || hle_malloc) {
+			init_hle(proc, hle);
+		}
+
+		/* Decode read-only executable segments after HLE has patched them */
+		if (predecode) {
+			predecode_text(proc);
+		}
+
+		/* Calibrate the cycle counter once for the guest clock and the syscall tracer */
+		time_page host_clock;
+		if (!instret_time || trace_file.size() > 0) {
+			host_clock.calibrate();
+		}
+		if (instret_time) {
+			proc.clock.calibrate_instret(instret_time);
+		} else {
+			proc.clock = host_clock;
+		}
+
+		/* Start the syscall offload threads, only when asked for */
+		std::unique_ptr<typename P::offload_pool_type> io_pool;
+		if (io_threads) {
+			io_pool = std::unique_ptr<typename P::offload_pool_type>(
+				new typename P::offload_pool_type(io_threads));
+			proc.io_pool = io_pool.get();
+		}
+
+		/* Start the syscall tracer, the tick scale is calibrated for the decoder */
+		std::unique_ptr<syscall_trace_file> trace_out;
+		std::unique_ptr<syscall_trace<>> trace;
+		if (trace_file.size() > 0) {
+			trace_out = std::unique_ptr<syscall_trace_file>(
+				new syscall_trace_file(trace_file.c_str(), host_clock.scale));
+			trace = std::unique_ptr<syscall_trace<>>(
+				new syscall_trace<>(*trace_out, proc.hart_id));
+			proc.trace = trace.get();
+		}
 
 		/* setup signal handlers */
 		proc.init();
@@ -1093,10 +1751,11 @@ struct riscv_emulator
 		ProfilerStop();
 #endif
 
+		/* Report HLE verification results */
+		hle.report();
+
 		/* Unmap memory segments */
-		for (auto &seg: proc.mmu.segments) {
-			munmap(seg.first, seg.second);
-		}
+		proc.mmu.unmap_all();
 	}
 
 	/* Start a specific processor implementation based on ELF type and ISA extensions */
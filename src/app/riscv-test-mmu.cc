@@ -10,28 +10,72 @@
 #include <cinttypes>
 #include <cstdarg>
 #include <cerrno>
+#include <ctime>
 #include <cassert>
 #include <string>
+#include <memory>
+#include <utility>
+#include <type_traits>
 #include <vector>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <algorithm>
 
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#if defined (__linux__)
+#include <sys/sendfile.h>
+#endif
 
 #include "riscv-endian.h"
 #include "riscv-types.h"
 #include "riscv-bits.h"
 #include "riscv-meta.h"
 #include "riscv-util.h"
+#include "riscv-host.h"
+#include "riscv-codec.h"
 #include "riscv-processor.h"
 #include "riscv-machine.h"
 #include "riscv-pte.h"
 #include "riscv-pma.h"
+#include "riscv-pmp.h"
 #include "riscv-memory.h"
 #include "riscv-tlb.h"
 #include "riscv-cache.h"
+#include "riscv-mmio.h"
 #include "riscv-mmu.h"
+#include "riscv-shootdown.h"
+#include "riscv-console.h"
+#include "riscv-abi-syscall.h"
+#include "riscv-time-page.h"
+#include "riscv-syscall-log.h"
+#include "riscv-fd-table.h"
+#include "riscv-syscall-trace.h"
+#include "riscv-unknown-abi.h"
 
 using namespace riscv;
 
+/* a device with a single 8 byte register */
+struct test_mmio_device : mmio_device<u64>
+{
+	u64 reg = 0;
+
+	test_mmio_device(u64 mmio_base) : mmio_device<u64>(mmio_base, 8) {}
+
+	u64 load(u64 offset, size_t len) { return reg >> (offset << 3); }
+	void store(u64 offset, u64 val, size_t len) { reg = val << (offset << 3); }
+	bool irq_pending() { return reg != 0; }
+};
+
 int main(int argc, char *argv[])
 {
 	assert(page_shift == 12);
@@ -94,9 +138,226 @@ int main(int argc, char *argv[])
 	// test that invalid_ppn is returned for (VA=0x10000, ASID=0)
 	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 0, /* VA */ 0x10000) == nullptr);
 
+	// test ASID flush only evicts entries for the given ASID
+	mmu.l1_dtlb.insert(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x10000, /* PTE */ 0xff, /* PPN */ 0x1);
+	mmu.l1_dtlb.insert(/* PDID */ 0, /* ASID */ 2, /* VA */ 0x11000, /* PTE */ 0xff, /* PPN */ 0x2);
+	mmu.l1_dtlb.flush(/* PDID */ 0, /* ASID */ 1);
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x10000) == nullptr);
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 2, /* VA */ 0x11000) != nullptr);
+
+	// test page flush only evicts the entry for the given page
+	mmu.l1_dtlb.insert(/* PDID */ 0, /* ASID */ 2, /* VA */ 0x12000, /* PTE */ 0xff, /* PPN */ 0x3);
+	mmu.l1_dtlb.flush(/* PDID */ 0, /* ASID */ 2, /* VA */ 0x11000);
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 2, /* VA */ 0x11000) == nullptr);
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 2, /* VA */ 0x12000) != nullptr);
+	mmu.l1_dtlb.flush(0);
+
+	// test remote shootdown of a range is deferred until drained by the target hart
+	shootdown_rv64 sd;
+	mmu.l1_itlb.insert(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x20000, /* PTE */ 0xff, /* PPN */ 0x4);
+	mmu.l1_dtlb.insert(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x21000, /* PTE */ 0xff, /* PPN */ 0x5);
+	mmu.l1_dtlb.insert(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x23000, /* PTE */ 0xff, /* PPN */ 0x6);
+	sd.remote_sfence_vm_range(/* hart_mask */ 0b10, /* ASID */ 1, /* VA */ 0x20000, /* size */ 0x1000);
+	sd.remote_sfence_vm_range(/* hart_mask */ 0b10, /* ASID */ 1, /* VA */ 0x21000, /* size */ 0x1000);
+	assert(sd.queue(1).count == 1); // adjacent ranges are coalesced
+	assert(sd.queue(0).drain(0, mmu.l1_itlb, mmu.l1_dtlb) == shootdown_flag_none);
+	assert(mmu.l1_itlb.lookup(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x20000) != nullptr);
+	assert(sd.queue(1).drain(0, mmu.l1_itlb, mmu.l1_dtlb) == shootdown_flag_range);
+	assert(mmu.l1_itlb.lookup(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x20000) == nullptr);
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x21000) == nullptr);
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x23000) != nullptr);
+	assert(sd.queue(1).drain(0, mmu.l1_itlb, mmu.l1_dtlb) == shootdown_flag_none);
+
+	// test large ranges are promoted to an ASID flush
+	sd.remote_sfence_vm_range(/* hart_mask */ 0b1, /* ASID */ 1, /* VA */ 0x0, /* size */ 0x1000000);
+	assert(sd.queue(0).count == 1 && sd.queue(0).ranges[0].whole_asid());
+	assert(sd.queue(0).drain(0, mmu.l1_itlb, mmu.l1_dtlb) == shootdown_flag_range);
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 1, /* VA */ 0x23000) == nullptr);
+
+	// test queue overflow is promoted to a full flush
+	for (u64 asid = 0; asid < 32; asid++) sd.remote_sfence_vm(/* hart_mask */ 0b1, asid);
+	assert(sd.queue(0).drain(0, mmu.l1_itlb, mmu.l1_dtlb) & shootdown_flag_flush_all);
+
+	// test remote fence.i
+	sd.remote_fence_i(/* hart_mask */ 0b1);
+	assert(sd.queue(0).drain(0, mmu.l1_itlb, mmu.l1_dtlb) == shootdown_flag_fence_i);
+
 	// add RAM to the MMU emulation
 	mmu.mem.add_ram(0x0, /*1GB*/0x40000000LL);
 
 	// look up the User Virtual Address for a Machine Physical Adress
 	assert(mmu.mem.mpa_to_uva(0x1000) == mmu.mem.segments.front().uva + 0x1000LL);
+
+	// test PMP region matching (NAPOT, NA4 and TOR)
+	processor_priv_rv64imafd proc;
+	proc.pmpaddr[0] = (0x20000 >> 2) | ((0x1000 >> 3) - 1);         // NAPOT 0x20000-0x20fff
+	proc.pmpaddr[1] = 0x21000 >> 2;                                // NA4 0x21000-0x21003
+	proc.pmpaddr[2] = 0x30000 >> 2;                                // TOR 0x21000-0x2ffff
+	proc.pmpcfg[0] = (u64(pmp_cfg_R | (pmp_match_napot << pmp_cfg_A_shift)) << 0) |
+	                 (u64(pmp_cfg_X | (pmp_match_na4 << pmp_cfg_A_shift)) << 8) |
+	                 (u64(pmp_cfg_R | pmp_cfg_W | (pmp_match_tor << pmp_cfg_A_shift)) << 16);
+	assert(pmp_page_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, 0x20000) == (pmp_page_valid | pmp_cfg_R));
+	assert(pmp_page_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, 0x21000) & pmp_page_partial);
+	assert(pmp_page_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, 0x22000) == (pmp_page_valid | pmp_cfg_R | pmp_cfg_W));
+	assert(pmp_page_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, 0x30000) == pmp_page_valid);
+	assert(pmp_page_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_M, 0x30000) == (pmp_page_valid | pmp_perm_mask));
+	assert(pmp_access_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, 0x21000, 4) == pmp_cfg_X);
+	assert(pmp_access_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, 0x21004, 8) == (pmp_cfg_R | pmp_cfg_W));
+	assert(pmp_access_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, 0x20ffc, 8) == 0);
+
+	// build an sv39 page table mapping VA 0x10000 -> PA 0x20000 and 0x11000 -> 0x21000
+	u64 *root = (u64*)mmu.mem.mpa_to_uva(0x1000);
+	u64 *l1 = (u64*)mmu.mem.mpa_to_uva(0x2000);
+	u64 *l0 = (u64*)mmu.mem.mpa_to_uva(0x3000);
+	root[0] = (0x2 << 10) | pte_flag_V;
+	l1[0] = (0x3 << 10) | pte_flag_V;
+	l0[0x10] = (0x20 << 10) | pte_flag_V | pte_flag_R | pte_flag_W | pte_flag_X;
+	l0[0x11] = (0x21 << 10) | pte_flag_V | pte_flag_R | pte_flag_W | pte_flag_X;
+	proc.pdid = 0;
+	proc.sptbr = 0x1;
+	proc.mode = priv_mode_S;
+	proc.mstatus.status.vm = riscv_vm_sv39;
+
+	// test the PMP result is computed at TLB refill and cached in the entry
+	tlb_type::tlb_entry_t *ent;
+	assert(mmu.get_physical_address(proc, 0x10008, false, ent) == 0x20008);
+	assert(ent != nullptr && ent->pmp == (pmp_page_valid | pmp_cfg_R));
+	assert(mmu.l1_dtlb.lookup(/* PDID */ 0, /* ASID */ 0, /* VA */ 0x10000) == ent);
+	assert(mmu.pmp_check(proc, 0x20008, 8, ent) == pmp_cfg_R);
+
+	// test a page split by a region boundary is checked per access
+	assert(mmu.get_physical_address(proc, 0x11000, false, ent) == 0x21000);
+	assert(ent != nullptr && (ent->pmp & pmp_page_partial));
+	assert(mmu.pmp_check(proc, 0x21000, 4, ent) == pmp_cfg_X);
+	assert(mmu.pmp_check(proc, 0x21008, 8, ent) == (pmp_cfg_R | pmp_cfg_W));
+
+	// test loads and stores are denied by PMP
+	u64 val = 0;
+	assert(mmu.load(proc, 0x10008, val, true, true));
+	assert(!mmu.store(proc, 0x10008, val, true, true));
+	assert(mmu.store(proc, 0x11008, u64(42), true, true));
+	assert(mmu.load(proc, 0x11008, val, true, true) && val == 42);
+	assert(!mmu.load(proc, 0x11000, val, true, true));
+
+	// test untranslated accesses use the physical page cache until it is flushed
+	proc.mode = priv_mode_M;
+	assert(mmu.store(proc, 0x20008, u64(7), true, false));
+	proc.mode = priv_mode_S;
+	assert(!mmu.store(proc, 0x20008, u64(7), true, false));
+	assert(mmu.l1_pmp.ent[0x20 & decltype(mmu.l1_pmp)::mask].tag == (0x20 << 1));
+	assert(mmu.load(proc, 0x20008, val, true, false) && val == 7);
+	assert(mmu.load(proc, 0x21000, val, true, false) == false);
+	proc.pmpcfg[0] |= pmp_cfg_W;
+	assert(!mmu.store(proc, 0x20008, u64(8), true, false));
+	mmu.l1_pmp.flush();
+	assert(mmu.store(proc, 0x20008, u64(8), true, false));
+
+	// test accesses outside RAM are routed to memory mapped devices
+	test_mmio_device dev(0x40000000);
+	proc.mode = priv_mode_M;
+	assert(!mmu.store(proc, 0x40000000, u64(1), true, false));
+	mmu.mmio.add(&dev);
+	assert(!mmu.mmio.irq_pending());
+	assert(mmu.store(proc, 0x40000000, u64(0x1234), true, false) && dev.reg == 0x1234);
+	assert(mmu.load(proc, 0x40000000, val, true, false) && val == 0x1234);
+	u8 byte = 0;
+	assert(mmu.load(proc, 0x40000001, byte, true, false) && byte == 0x12);
+	assert(mmu.mmio.irq_pending());
+	assert(!mmu.load(proc, 0x40000004, val, true, false));
+	proc.mode = priv_mode_S;
+
+	/* time page: fixed point scaling, served clocks and deterministic mode */
+	{
+		time_page tp;
+		assert(!tp.serves(abi_clock_monotonic));
+		tp.calibrate_instret(10);
+		assert(tp.serves(abi_clock_realtime) && tp.serves(abi_clock_boottime));
+		assert(!tp.serves(abi_clock_boottime + 1));
+		assert(tp.now_ns(abi_clock_monotonic, 1000) == 10000);
+		assert(tp.now_ns(abi_clock_realtime, 1000) == 10000);
+		assert(tp.now_ns(abi_clock_monotonic, 5ULL << 32) == s64(50ULL << 32));
+
+		/* a third of a nanosecond per tick, high and low halves scaled separately */
+		tp.scale = (1ULL << 32) / 3;
+		u64 ticks = (7ULL << 32) + 12345;
+		assert(tp.now_ns(abi_clock_monotonic, ticks) ==
+			s64((unsigned __int128)ticks * tp.scale >> 32));
+
+		tp.calibrate();
+		if (tp.valid) {
+			assert(!tp.deterministic && tp.scale > 0);
+			assert(tp.serves(abi_clock_monotonic_coarse) && tp.serves(abi_clock_realtime_coarse));
+			assert(!tp.serves(abi_clock_boottime) && !tp.serves(abi_clock_process_cputime_id));
+			s64 diff = tp.now_ns(abi_clock_realtime, 0) - time_page::host_ns(CLOCK_REALTIME);
+			assert(diff > -s64(time_page::calibrate_ns) && diff < s64(time_page::calibrate_ns));
+		}
+	}
+
+	/* fd table: standard streams carry guest flags, preloaded files are mapped */
+	{
+		fd_table fds;
+		assert(fds.get(0)->status_flags == abi_o_rdonly);
+		assert(fds.get(1)->status_flags == abi_o_wronly);
+		assert(fds.get(2)->status_flags == abi_o_wronly);
+
+		char filename[] = "/tmp/riscv-test-mmu-XXXXXX";
+		int fd = mkstemp(filename);
+		assert(fd >= 0);
+		assert(write(fd, "preloaded", 9) == 9);
+		close(fd);
+		fd_preload preload;
+		assert(preload.add(filename));
+		assert(!preload.add("/tmp"));
+		std::shared_ptr<fd_memfile> mf = preload.lookup(filename);
+		assert(mf && mf->size == 9 && memcmp(mf->data, "preloaded", 9) == 0);
+
+		/* guest mmaps map the same file through the retained host fd */
+		void *map = mmap(nullptr, page_size, PROT_READ, MAP_PRIVATE, mf->fd, 0);
+		assert(map != MAP_FAILED && memcmp(map, "preloaded", 9) == 0);
+		munmap(map, page_size);
+		unlink(filename);
+	}
+
+	/* proxy region map: page rounding, splitting and free range search */
+	{
+		proxy_region_map rm;
+		rm.add(0x10000, 0x12345, PROT_READ | PROT_EXEC);
+		rm.add(0x20000, 0x30000, PROT_READ | PROT_WRITE);
+		assert(rm.regions.size() == 2);
+		assert(rm.contains(0x10000, 0x13000));
+		assert(!rm.contains(0x10000, 0x14000));
+		assert(!rm.contains(0x12000, 0x21000));
+		assert(rm.is_free(0x13000, 0x20000));
+		assert(!rm.is_free(0x13000, 0x20001));
+
+		/* munmap in the middle splits the region */
+		rm.remove(0x24000, 0x26000);
+		assert(rm.regions.size() == 3);
+		assert(rm.contains(0x20000, 0x24000));
+		assert(rm.is_free(0x24000, 0x26000));
+		assert(rm.contains(0x26000, 0x30000));
+
+		/* mprotect across regions only changes the covered pages */
+		rm.protect(0x22000, 0x28000, PROT_READ);
+		assert(rm.regions.size() == 5);
+		assert(rm.regions[0x22000].prot == (PROT_READ | PROT_WRITE));
+		assert(rm.regions[0x24000].prot == PROT_READ);
+		assert(rm.regions[0x28000].prot == PROT_READ);
+		assert(rm.regions[0x30000].prot == (PROT_READ | PROT_WRITE));
+
+		/* restoring the protection merges the pieces with their neighbours */
+		rm.protect(0x22000, 0x24000, PROT_READ | PROT_WRITE);
+		rm.protect(0x26000, 0x28000, PROT_READ | PROT_WRITE);
+		assert(rm.regions.size() == 3);
+		assert(rm.regions[0x24000].begin == 0x20000);
+		assert(rm.regions[0x30000].begin == 0x26000);
+		assert(rm.has_prot(0x26000, 0x30000, PROT_READ | PROT_WRITE));
+
+		/* free ranges are allocated top down below the ceiling */
+		assert(rm.find_free(0x13000, 0x40000, 0x10000) == 0x30000);
+		assert(rm.find_free(0x13000, 0x30000, 0x2000) == 0x24000);
+		assert(rm.find_free(0x13000, 0x30000, 0x4000) == 0x1c000);
+		assert(rm.find_free(0x13000, 0x30000, 0x10000) == 0);
+		assert(rm.find_free(0x13000, 0x28000, 0x2000) == 0x24000);
+	}
 }
@@ -0,0 +1,108 @@
+//
+//  riscv-test-offload.cc
+//
+
+#undef NDEBUG
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cinttypes>
+#include <cstdarg>
+#include <cerrno>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+
+#include <unistd.h>
+
+#include "riscv-endian.h"
+#include "riscv-types.h"
+#include "riscv-bits.h"
+#include "riscv-util.h"
+#include "riscv-offload.h"
+
+using namespace riscv;
+
+struct pipe_read_request
+{
+	int fd;
+	char buf[16];
+	ssize_t ret;
+
+	void run() { ret = read(fd, buf, sizeof(buf)); }
+};
+
+int main(int argc, char *argv[])
+{
+	/* ring: single thread order and capacity */
+	{
+		mpmc_ring<int,4> ring;
+		int v;
+		assert(ring.empty());
+		assert(!ring.pop(v));
+		for (int i = 0; i < 4; i++) assert(ring.push(i));
+		assert(!ring.push(4));
+		for (int i = 0; i < 4; i++) assert(ring.pop(v) && v == i);
+		assert(ring.empty());
+	}
+
+	/* ring: concurrent producers and consumers see every value once */
+	{
+		const int producers = 4, consumers = 4, count = 100000;
+		mpmc_ring<int,64> ring;
+		std::atomic<u64> sum(0), popped(0);
+		std::vector<std::thread> threads;
+		for (int p = 0; p < producers; p++) {
+			threads.push_back(std::thread([&, p] {
+				for (int i = 0; i < count; i++) {
+					while (!ring.push(p * count + i)) std::this_thread::yield();
+				}
+			}));
+		}
+		for (int c = 0; c < consumers; c++) {
+			threads.push_back(std::thread([&] {
+				int v;
+				while (popped < u64(producers * count)) {
+					if (ring.pop(v)) { sum += v; popped++; }
+					else std::this_thread::yield();
+				}
+			}));
+		}
+		for (auto &t : threads) t.join();
+		u64 n = u64(producers) * count;
+		assert(popped == n);
+		assert(sum == n * (n - 1) / 2);
+	}
+
+	/* pool: a blocking read completes only after data arrives */
+	{
+		int fds[2];
+		assert(pipe(fds) == 0);
+		offload_pool<pipe_read_request> pool(2);
+		pipe_read_request req;
+		req.fd = fds[0];
+		req.ret = -1;
+		pool.submit(&req);
+
+		pool.wait(10000);
+		assert(pool.complete() == nullptr);
+
+		assert(write(fds[1], "hello", 5) == 5);
+		pipe_read_request *done;
+		while (!(done = pool.complete())) pool.wait(1000);
+		assert(done == &req);
+		assert(req.ret == 5 && memcmp(req.buf, "hello", 5) == 0);
+		close(fds[0]);
+		close(fds[1]);
+	}
+
+	printf("offload: ok\n");
+}
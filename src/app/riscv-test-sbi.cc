@@ -0,0 +1,146 @@
+//
+//  riscv-test-sbi.cc
+//
+
+#undef NDEBUG
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cinttypes>
+#include <cstdarg>
+#include <cerrno>
+#include <cassert>
+#include <string>
+#include <memory>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "riscv-endian.h"
+#include "riscv-types.h"
+#include "riscv-bits.h"
+#include "riscv-meta.h"
+#include "riscv-util.h"
+#include "riscv-host.h"
+#include "riscv-codec.h"
+#include "riscv-processor.h"
+#include "riscv-machine.h"
+#include "riscv-pte.h"
+#include "riscv-pma.h"
+#include "riscv-pmp.h"
+#include "riscv-memory.h"
+#include "riscv-tlb.h"
+#include "riscv-cache.h"
+#include "riscv-mmio.h"
+#include "riscv-mmu.h"
+#include "riscv-shootdown.h"
+#include "riscv-console.h"
+#include "riscv-sbi-proxy.h"
+
+using namespace riscv;
+
+/* the state proxy_sbi uses from a privileged processor */
+struct sbi_test_proc : processor_priv_rv64imafd
+{
+	typedef mmu_rv64 mmu_type;
+
+	const u64 misa_default = (u64(riscv_isa_rv64) << 62) | 0x1129; /* IMAFD */
+	mmu_type mmu;
+	shootdown_rv64 *shootdown_domain;
+	u64 sbi_config;
+	console_writer<> console;
+	console_reader<> console_input;
+
+	sbi_test_proc(int out_fd, int in_fd) :
+		shootdown_domain(nullptr), sbi_config(0), console(out_fd), console_input(in_fd) {}
+
+	u64 call(sbi_call fn, u64 a0 = 0, u64 a1 = 0, u64 a2 = 0, u64 a3 = 0)
+	{
+		ireg[riscv_ireg_a0] = a0;
+		ireg[riscv_ireg_a1] = a1;
+		ireg[riscv_ireg_a2] = a2;
+		ireg[riscv_ireg_a3] = a3;
+		ireg[riscv_ireg_a7] = u64(fn);
+		proxy_sbi(*this);
+		return ireg[riscv_ireg_a0].r.xu.val;
+	}
+};
+
+int main(int argc, char *argv[])
+{
+	int out[2], in[2];
+	assert(pipe(out) == 0);
+	assert(pipe(in) == 0);
+
+	sbi_test_proc proc(out[1], in[0]);
+	shootdown_rv64 sd;
+	proc.shootdown_domain = &sd;
+	proc.mhartid = 0;
+	proc.mmu.mem.add_ram(0x0, 0x100000);
+
+	/* config string describes the RAM and ISA and is returned as a physical address */
+	assert(sbi_install_config(proc, 0xff000, 0x0, 0x100000));
+	assert(proc.call(sbi_call_config_string) == 0xff000);
+	std::string config((const char*)proc.mmu.mem.mpa_to_uva(0xff000));
+	assert(config.find("size 0x100000;") != std::string::npos);
+	assert(config.find("isa rv64imafd;") != std::string::npos);
+	assert(!sbi_install_config(proc, 0xfffc0, 0x0, 0x100000));
+
+	/* call numbers are the legacy SBI v0.1 numbers */
+	assert(sbi_call_set_timer == 0 && sbi_call_console_putchar == 1 && sbi_call_console_getchar == 2);
+	assert(sbi_call_clear_ipi == 3 && sbi_call_send_ipi == 4 && sbi_call_remote_fence_i == 5);
+	assert(sbi_call_remote_sfence_vma == 6 && sbi_call_remote_sfence_vma_asid == 7);
+	assert(sbi_call_shutdown == 8);
+
+	/* the timer programs mtimecmp and clears a pending supervisor timer interrupt */
+	proc.mip.ip.stip = 1;
+	assert(proc.call(sbi_call_set_timer, 123456789) == 0);
+	assert(proc.mtimecmp == 123456789 && !proc.mip.ip.stip);
+
+	/* software interrupts to the harts in the mask */
+	*(u64*)proc.mmu.mem.mpa_to_uva(0x1000) = 0b10;
+	assert(proc.call(sbi_call_send_ipi, 0x1000) == 0 && !proc.mip.ip.ssip);
+	*(u64*)proc.mmu.mem.mpa_to_uva(0x1000) = 0b1;
+	assert(proc.call(sbi_call_send_ipi, 0x1000) == 0 && proc.mip.ip.ssip);
+	assert(proc.call(sbi_call_clear_ipi) == 1 && !proc.mip.ip.ssip);
+	assert(proc.call(sbi_call_send_ipi, 0) == 0 && proc.mip.ip.ssip);
+	assert(proc.call(sbi_call_clear_ipi) == 1 && proc.call(sbi_call_clear_ipi) == 0);
+	assert(proc.call(sbi_call_send_ipi, 0x200000) == u64(-1));
+
+	/* console */
+	assert(proc.call(sbi_call_console_putchar, 'x') == 0);
+	proc.console.flush();
+	char ch;
+	assert(read(out[0], &ch, 1) == 1 && ch == 'x');
+	assert(proc.call(sbi_call_console_getchar) == u64(-1));
+	assert(write(in[1], "z", 1) == 1);
+	proc.console_input.poll();
+	assert(proc.call(sbi_call_console_getchar) == 'z');
+
+	/* remote fences return 0 and queue work for the masked harts */
+	assert(proc.call(sbi_call_remote_sfence_vma_asid, 0x1000, 0x20000, 0x1000, 1) == 0);
+	assert(sd.queue(0).count == 1 && sd.queue(0).ranges[0].asid == 1 && sd.queue(1).count == 0);
+	assert(sd.queue(0).drain(0, proc.mmu.l1_itlb, proc.mmu.l1_dtlb) == shootdown_flag_range);
+	assert(proc.call(sbi_call_remote_sfence_vma, 0, 0x20000, 0x1000) == 0);
+	assert(sd.queue(1).drain(0, proc.mmu.l1_itlb, proc.mmu.l1_dtlb) & shootdown_flag_flush_all);
+	assert(proc.call(sbi_call_remote_fence_i, 0x1000) == 0);
+	assert(sd.queue(0).drain(0, proc.mmu.l1_itlb, proc.mmu.l1_dtlb) & shootdown_flag_fence_i);
+
+	/* an unreadable hart mask fails without queueing */
+	assert(proc.call(sbi_call_remote_fence_i, 0x200000) == u64(-1));
+	assert(sd.queue(0).drain(0, proc.mmu.l1_itlb, proc.mmu.l1_dtlb) == shootdown_flag_none);
+
+	printf("sbi: %s", config.c_str());
+	return 0;
+}
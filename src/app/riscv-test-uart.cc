@@ -0,0 +1,151 @@
+//
+//  riscv-test-uart.cc
+//
+
+#undef NDEBUG
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cinttypes>
+#include <cstdarg>
+#include <cerrno>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "riscv-endian.h"
+#include "riscv-types.h"
+#include "riscv-bits.h"
+#include "riscv-util.h"
+#include "riscv-console.h"
+#include "riscv-mmio.h"
+#include "riscv-uart.h"
+
+using namespace riscv;
+
+static std::string read_all(int fd)
+{
+	std::string s;
+	char buf[1024];
+	ssize_t ret;
+	while ((ret = read(fd, buf, sizeof(buf))) > 0) s.append(buf, ret);
+	return s;
+}
+
+int main(int argc, char *argv[])
+{
+	int out[2], in[2];
+	assert(pipe(out) == 0);
+	assert(pipe(in) == 0);
+
+	/* drain the output pipe so the writer thread never blocks */
+	std::string s;
+	std::thread drain([&] { s = read_all(out[0]); });
+
+	u64 writes, bytes;
+	{
+		console_writer<> writer(out[1]);
+		console_reader<> reader(in[0]);
+		uart_16550_rv64 uart(0x10000000, writer, reader);
+
+		/* transmitter is always ready */
+		assert(uart.mmio_load(uart_reg_lsr) & uart_lsr_thre);
+
+		/* registers are reached through the MMU device bus */
+		mmio_device_adapter<u64,uart_16550_rv64> uart_mmio(uart, uart_size);
+		assert(uart_mmio.mmio_base == 0x10000000 && uart_mmio.mmio_size == uart_size);
+		assert(uart_mmio.load(uart_reg_lsr, 1) & uart_lsr_thre);
+		uart_mmio.store(uart_reg_scr, 0x5a, 1);
+		assert(uart.mmio_load(uart_reg_scr) == 0x5a);
+
+		/* divisor latch does not transmit */
+		uart.mmio_store(uart_reg_lcr, uart_lcr_dlab);
+		uart.mmio_store(uart_reg_dll, 1);
+		assert(uart.mmio_load(uart_reg_dll) == 1);
+		uart.mmio_store(uart_reg_lcr, 0x03);
+
+		/* the writer thread is started by the first output */
+		assert(!writer.writer.joinable());
+
+		/* a line of output is batched into few host writes */
+		const char *line = "hello from the guest\n";
+		for (const char *p = line; *p; p++) uart.mmio_store(uart_reg_thr, *p);
+		writer.flush();
+		assert(writer.byte_count == strlen(line));
+		assert(writer.write_count <= 2);
+
+		/* output without a newline is written after the deadline */
+		uart.mmio_store(uart_reg_thr, '>');
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		assert(writer.byte_count == strlen(line) + 1);
+
+		/* more output than the ring holds is not dropped */
+		for (size_t i = 0; i < 100000; i++) uart.mmio_store(uart_reg_thr, 'a' + i % 26);
+		writer.flush();
+		assert(writer.byte_count == strlen(line) + 1 + 100000);
+
+		/* a byte written while the writer goes idle is still written by the deadline */
+		u64 expect = writer.byte_count;
+		for (int i = 0; i < 100; i++) {
+			uart.mmio_store(uart_reg_thr, '.');
+			expect++;
+			auto until = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+			while (writer.byte_count != expect && std::chrono::steady_clock::now() < until) {
+				std::this_thread::yield();
+			}
+			assert(writer.byte_count == expect);
+		}
+
+		/* input is only visible after polling */
+		assert(write(in[1], "xy", 2) == 2);
+		assert(!(uart.mmio_load(uart_reg_lsr) & uart_lsr_dr));
+		uart.mmio_store(uart_reg_ier, uart_ier_rdi);
+		assert(!uart.irq_pending());
+		uart.poll();
+		assert(uart.irq_pending());
+		assert(uart.mmio_load(uart_reg_iir) == (uart_iir_fifo | uart_iir_rdi));
+		assert(uart.mmio_load(uart_reg_lsr) & uart_lsr_dr);
+		assert(uart.mmio_load(uart_reg_rbr) == 'x');
+		assert(uart.mmio_load(uart_reg_rbr) == 'y');
+		assert(!(uart.mmio_load(uart_reg_lsr) & uart_lsr_dr));
+		assert(uart.mmio_load(uart_reg_iir) == (uart_iir_fifo | uart_iir_none));
+
+		/* the THRE interrupt is raised when enabled and cleared by reading IIR */
+		uart.mmio_store(uart_reg_ier, uart_ier_thri);
+		assert(uart.irq_pending());
+		assert(uart.mmio_load(uart_reg_iir) == (uart_iir_fifo | uart_iir_thri));
+		assert(!uart.irq_pending());
+		assert(uart.mmio_load(uart_reg_iir) == (uart_iir_fifo | uart_iir_none));
+		uart.mmio_store(uart_reg_thr, '\n');
+		assert(uart.irq_pending());
+		uart.mmio_store(uart_reg_ier, 0);
+		assert(!uart.irq_pending());
+		writer.flush();
+
+		/* polling with no input does not block */
+		uart.poll();
+		assert(uart.mmio_load(uart_reg_rbr) == 0);
+
+		writes = writer.write_count;
+		bytes = writer.byte_count;
+	}
+
+	close(out[1]);
+	drain.join();
+	assert(s.size() == bytes);
+	assert(s.compare(0, 22, "hello from the guest\n>") == 0);
+
+	printf("uart: %llu bytes in %llu host writes\n",
+		(unsigned long long)bytes, (unsigned long long)writes);
+}
@@ -0,0 +1,175 @@
+//
+//  riscv-test-virtio.cc
+//
+
+#undef NDEBUG
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cinttypes>
+#include <cstdarg>
+#include <cerrno>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "riscv-endian.h"
+#include "riscv-types.h"
+#include "riscv-bits.h"
+#include "riscv-util.h"
+#include "riscv-pma.h"
+#include "riscv-memory.h"
+#include "riscv-mmio.h"
+#include "riscv-virtio.h"
+
+using namespace riscv;
+
+/* guest physical layout used by the test driver */
+enum {
+	ram_base   = 0x80000000,
+	ram_size   = 0x00100000,
+	mmio_base  = 0x10001000,
+	desc_addr  = ram_base + 0x0000,
+	avail_addr = ram_base + 0x1000,
+	used_addr  = ram_base + 0x2000,
+	hdr_addr   = ram_base + 0x3000,
+	stat_addr  = ram_base + 0x3100,
+	data_addr  = ram_base + 0x4000,
+	queue_size = 16,
+};
+
+typedef virtio_blk_rv64 blk_type;
+
+static void* ptr(user_memory<u64> &mem, u64 mpa) { return (void*)mem.mpa_to_uva(mpa); }
+
+/* queue a three descriptor request chain (header, data, status) */
+static void queue_request(user_memory<u64> &mem, u16 slot, u32 type, u64 sector,
+	u64 data, u32 len, bool device_writes)
+{
+	virtq_desc *desc = (virtq_desc*)ptr(mem, desc_addr);
+	virtq_avail *avail = (virtq_avail*)ptr(mem, avail_addr);
+	virtio_blk_req_hdr *hdr = (virtio_blk_req_hdr*)ptr(mem, hdr_addr + slot * 16);
+	u16 d = slot * 3;
+
+	hdr->type = type;
+	hdr->reserved = 0;
+	hdr->sector = sector;
+	desc[d] = { hdr_addr + slot * 16u, sizeof(virtio_blk_req_hdr), virtio_desc_flag_next, u16(d + 1) };
+	desc[d + 1] = { data, len, u16(virtio_desc_flag_next | (device_writes ? virtio_desc_flag_write : 0)), u16(d + 2) };
+	desc[d + 2] = { stat_addr + slot, 1, virtio_desc_flag_write, 0 };
+	*(u8*)ptr(mem, stat_addr + slot) = 0xff;
+	avail->ring[avail->idx % queue_size] = d;
+	avail->idx++;
+}
+
+int main(int argc, char *argv[])
+{
+	/* create a 64KiB image file filled with a sector number pattern */
+	char filename[] = "/tmp/riscv-test-virtio-XXXXXX";
+	int fd = mkstemp(filename);
+	assert(fd >= 0);
+	std::vector<u8> pattern(65536);
+	for (size_t i = 0; i < pattern.size(); i++) pattern[i] = u8(i >> 9) ^ u8(i);
+	assert(write(fd, pattern.data(), pattern.size()) == ssize_t(pattern.size()));
+	close(fd);
+
+	user_memory<u64> mem;
+	mem.add_ram(ram_base, ram_size);
+
+	blk_type blk(mem, mmio_base);
+	assert(blk.open_image(filename, false));
+
+	/* the register window is reached through the MMU device bus */
+	mmio_bus<u64> bus;
+	mmio_device_adapter<u64,blk_type> blk_mmio(blk, virtio_mmio_size);
+	bus.add(&blk_mmio);
+	assert(bus.lookup(mmio_base + virtio_mmio_version, 4) == &blk_mmio);
+	assert(bus.lookup(mmio_base + virtio_mmio_size, 4) == nullptr);
+	assert(blk_mmio.load(virtio_mmio_magic_value, 4) == virtio_mmio_magic);
+
+	/* probe */
+	assert(blk.mmio_load(virtio_mmio_magic_value) == virtio_mmio_magic);
+	assert(blk.mmio_load(virtio_mmio_version) == 2);
+	assert(blk.mmio_load(virtio_mmio_device_id) == virtio_device_id_blk);
+	assert(blk.mmio_load(virtio_mmio_config) == 128); /* capacity in sectors */
+	blk.mmio_store(virtio_mmio_device_features_sel, 1);
+	assert(blk.mmio_load(virtio_mmio_device_features) & 1); /* VIRTIO_F_VERSION_1 */
+
+	/* configure the queue */
+	blk.mmio_store(virtio_mmio_queue_sel, 0);
+	blk.mmio_store(virtio_mmio_queue_num, queue_size);
+	blk.mmio_store(virtio_mmio_queue_desc_low, u32(desc_addr));
+	blk.mmio_store(virtio_mmio_queue_desc_high, 0);
+	blk.mmio_store(virtio_mmio_queue_driver_low, u32(avail_addr));
+	blk.mmio_store(virtio_mmio_queue_driver_high, 0);
+	blk.mmio_store(virtio_mmio_queue_device_low, u32(used_addr));
+	blk.mmio_store(virtio_mmio_queue_device_high, 0);
+	blk.mmio_store(virtio_mmio_queue_ready, 1);
+	blk.mmio_store(virtio_mmio_status, 0xf);
+
+	/* batch two reads and a write into one notify */
+	queue_request(mem, 0, virtio_blk_t_in, 2, data_addr, 1024, true);
+	queue_request(mem, 1, virtio_blk_t_in, 100, data_addr + 0x1000, 512, true);
+	memset(ptr(mem, data_addr + 0x2000), 0xa5, 512);
+	queue_request(mem, 2, virtio_blk_t_out, 7, data_addr + 0x2000, 512, false);
+	blk.mmio_store(virtio_mmio_queue_notify, 0);
+
+	virtq_used *used = (virtq_used*)ptr(mem, used_addr);
+	assert(used->idx == 3);
+	assert(blk.notify_count == 1);
+	assert(blk.request_count == 3);
+	assert(used->ring[0].id == 0 && used->ring[0].len == 1025);
+	assert(used->ring[2].id == 6 && used->ring[2].len == 1);
+	assert(*(u8*)ptr(mem, stat_addr + 0) == virtio_blk_s_ok);
+	assert(*(u8*)ptr(mem, stat_addr + 1) == virtio_blk_s_ok);
+	assert(*(u8*)ptr(mem, stat_addr + 2) == virtio_blk_s_ok);
+	assert(memcmp(ptr(mem, data_addr), pattern.data() + 1024, 1024) == 0);
+	assert(memcmp(ptr(mem, data_addr + 0x1000), pattern.data() + 51200, 512) == 0);
+	assert(blk.image[7 * 512] == 0xa5 && blk.image[8 * 512 - 1] == 0xa5);
+
+	/* interrupt is raised once per notify and acknowledged by the driver */
+	assert(blk.mmio_load(virtio_mmio_interrupt_status) == virtio_interrupt_used_buffer);
+	blk.mmio_store(virtio_mmio_interrupt_ack, virtio_interrupt_used_buffer);
+	assert(!blk.irq_pending());
+
+	/* out of range read fails with an I/O error */
+	queue_request(mem, 0, virtio_blk_t_in, 127, data_addr, 1024, true);
+	blk.mmio_store(virtio_mmio_queue_notify, 0);
+	assert(used->idx == 4);
+	assert(*(u8*)ptr(mem, stat_addr + 0) == virtio_blk_s_ioerr);
+
+	/* a sector whose byte offset wraps to zero is still out of range */
+	queue_request(mem, 0, virtio_blk_t_in, 1ULL << 55, data_addr, 512, true);
+	blk.mmio_store(virtio_mmio_queue_notify, 0);
+	assert(used->idx == 5);
+	assert(*(u8*)ptr(mem, stat_addr + 0) == virtio_blk_s_ioerr);
+
+	/* a status descriptor the device may not write is left untouched */
+	queue_request(mem, 0, virtio_blk_t_in, 0, data_addr, 512, true);
+	((virtq_desc*)ptr(mem, desc_addr))[2].flags = 0;
+	blk.mmio_store(virtio_mmio_queue_notify, 0);
+	assert(used->idx == 6 && used->ring[5].len == 0);
+	assert(*(u8*)ptr(mem, stat_addr + 0) == 0xff);
+
+	/* flush writes the image back to the file */
+	queue_request(mem, 1, virtio_blk_t_flush, 0, data_addr, 0, true);
+	blk.mmio_store(virtio_mmio_queue_notify, 0);
+	assert(*(u8*)ptr(mem, stat_addr + 1) == virtio_blk_s_ok);
+	blk.close_image();
+
+	fd = open(filename, O_RDONLY);
+	u8 sector[512];
+	assert(pread(fd, sector, sizeof(sector), 7 * 512) == 512);
+	assert(sector[0] == 0xa5 && sector[511] == 0xa5);
+	close(fd);
+	unlink(filename);
+
+	printf("virtio-blk: %llu requests in %llu notifies\n",
+		(unsigned long long)blk.request_count, (unsigned long long)blk.notify_count);
+}
@@ -0,0 +1,208 @@
+//
+//  riscv-batch.h
+//
+
+#ifndef riscv_batch_h
+#define riscv_batch_h
+
+/*
+ * Batch Instruction Fetch
+ * =======================
+ * inst_fetch_batch fetches up to count instructions from [pc, end) into
+ * inst and len, advancing pc past them. Instruction boundaries are found
+ * 16 parcels at a time from a mask of the parcels whose low bits are 11,
+ * computed with AVX2 when the binary is built for AVX2 or when a program
+ * sets inst_batch_host<>::avx2 from the host_cpu caps at startup. 48-bit
+ * and 64-bit instructions, the tail of the buffer and hosts without AVX2
+ * use inst_fetch. An illegal length fetches a zero instruction and skips
+ * one parcel so that scans always make progress.
+ *
+ *   inline size_t riscv::inst_fetch_batch(riscv::addr_t &pc, riscv::addr_t end, riscv::inst_t *inst, riscv::u8 *len, size_t count)
+ *
+ * decode_batch holds the pc, instruction and decode record of a batch.
+ *
+ *   template <typename T> size_t riscv::decode_batch<T>::decode_rv64(riscv::addr_t &pc, riscv::addr_t end)
+ */
+
+namespace riscv {
+
+	#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+	#define RISCV_BATCH_AVX2 1
+	#define RISCV_BATCH_AVX2_TARGET __attribute__((target("avx2")))
+	#else
+	#define RISCV_BATCH_AVX2 0
+	#endif
+
+	template <typename T = void>
+	struct inst_batch_host
+	{
+		static bool avx2;
+	};
+
+	#if defined __AVX2__
+	template <typename T> bool inst_batch_host<T>::avx2 = true;
+	#else
+	template <typename T> bool inst_batch_host<T>::avx2 = false;
+	#endif
+
+	/* fetch one instruction, illegal lengths fetch zero and skip a parcel */
+	inline size_t inst_fetch_one(addr_t addr, inst_t &inst)
+	{
+		addr_t pc_offset;
+		inst = inst_fetch(addr, pc_offset);
+		return pc_offset ? pc_offset : 2;
+	}
+
+	inline size_t inst_fetch_batch_scalar(addr_t &pc, addr_t end, inst_t *inst, u8 *len, size_t count)
+	{
+		size_t n = 0;
+		addr_t addr = pc;
+		while (n < count && addr < end) {
+			len[n] = u8(inst_fetch_one(addr, inst[n]));
+			addr += len[n++];
+		}
+		pc = addr;
+		return n;
+	}
+
+	#if RISCV_BATCH_AVX2
+
+	/*
+	 * instruction starts within 8 parcels indexed by carry in and the
+	 * mask of 32-bit parcels, entries hold the start mask in bits [7:0]
+	 * and carry out, a 32-bit instruction crossing into the next 8
+	 * parcels, in bit 8
+	 */
+	struct inst_start_table
+	{
+		u16 ent[2][256];
+
+		inst_start_table()
+		{
+			for (size_t carry = 0; carry < 2; carry++) {
+				for (size_t mask = 0; mask < 256; mask++) {
+					size_t i = carry, starts = 0;
+					while (i < 8) {
+						starts |= 1 << i;
+						i += (mask >> i) & 1 ? 2 : 1;
+					}
+					ent[carry][mask] = u16(starts | ((i - 8) << 8));
+				}
+			}
+		}
+
+		static const inst_start_table& get()
+		{
+			static const inst_start_table tab;
+			return tab;
+		}
+	};
+
+	typedef short inst_batch_v16hi __attribute__((vector_size(32)));
+
+	/*
+	 * parcel masks for 16 parcels, bits [15:0] are the parcels with low
+	 * bits 11 and bits [31:16] the parcels with low bits 11111
+	 */
+	RISCV_BATCH_AVX2_TARGET inline u32 inst_parcel_masks_avx2(addr_t addr)
+	{
+		inst_batch_v16hi v;
+		memcpy(&v, (const void*)addr, sizeof(v));
+		inst_batch_v16hi l = (v & 0b11) == 0b11;
+		inst_batch_v16hi e = (v & 0b11111) == 0b11111;
+		/* packs interleaves the masks per 128-bit lane: l[7:0] e[7:0] l[15:8] e[15:8] */
+		u32 m = u32(__builtin_ia32_pmovmskb256(__builtin_ia32_packsswb256(l, e)));
+		return (m & 0xff) | ((m >> 8) & 0xff00) | ((m << 8) & 0xff0000) | (m & 0xff000000);
+	}
+
+	RISCV_BATCH_AVX2_TARGET inline size_t inst_fetch_batch_avx2(addr_t &pc, addr_t end, inst_t *inst, u8 *len, size_t count)
+	{
+		const inst_start_table &tab = inst_start_table::get();
+		size_t n = 0;
+		addr_t addr = pc;
+
+		/* a block reads 16 parcels and a 32-bit instruction starting in the last */
+		while (n < count && addr < end && end - addr >= 36) {
+			u32 m = inst_parcel_masks_avx2(addr);
+			u32 lo = tab.ent[0][m & 0xff];
+			u32 hi = tab.ent[lo >> 8][(m >> 8) & 0xff];
+			u32 starts = (lo & 0xff) | ((hi & 0xff) << 8);
+			u32 irregular = starts & (m >> 16);
+			if (irregular) starts &= (1u << __builtin_ctz(irregular)) - 1;
+			addr_t next = addr;
+			if (!irregular && count - n >= 16) {
+				/* branch-free: write every parcel, advance n over the starts */
+				for (u32 i = 0; i < 16; i++) {
+					u32 wide = (m >> i) & 1;
+					inst[n] = htole32(*(uint32_t*)(addr + i * 2)) & (0xffff | (0xffff0000 * wide));
+					len[n] = u8(2 + wide * 2);
+					n += (starts >> i) & 1;
+				}
+				u32 i = 31 - __builtin_clz(starts);
+				addr += i * 2 + 2 + ((m >> i) & 1) * 2;
+				continue;
+			}
+			while (starts && n < count) {
+				u32 i = __builtin_ctz(starts);
+				u32 wide = (m >> i) & 1;
+				inst[n] = htole32(*(uint32_t*)(addr + i * 2)) & (0xffff | (0xffff0000 * wide));
+				len[n++] = u8(2 + wide * 2);
+				next = addr + i * 2 + 2 + wide * 2;
+				starts &= starts - 1;
+			}
+			if (irregular && n < count && !starts) {
+				next = addr + __builtin_ctz(irregular) * 2;
+				len[n] = u8(inst_fetch_one(next, inst[n]));
+				next += len[n++];
+			}
+			addr = next;
+		}
+
+		pc = addr;
+		return n + inst_fetch_batch_scalar(pc, end, inst + n, len + n, count - n);
+	}
+
+	#endif
+
+	inline size_t inst_fetch_batch(addr_t &pc, addr_t end, inst_t *inst, u8 *len, size_t count)
+	{
+	#if RISCV_BATCH_AVX2
+		if (inst_batch_host<>::avx2) {
+			return inst_fetch_batch_avx2(pc, end, inst, len, count);
+		}
+	#endif
+		return inst_fetch_batch_scalar(pc, end, inst, len, count);
+	}
+
+	/*
+	 * decode_batch
+	 *
+	 * pc, instruction, length and decode record for a batch of instructions
+	 */
+
+	template <typename T, const size_t batch_size = 256>
+	struct decode_batch
+	{
+		size_t count;
+		addr_t pc[batch_size];
+		inst_t inst[batch_size];
+		u8 len[batch_size];
+		T dec[batch_size];
+
+		/* fetch and decode the next batch from [addr, end), advancing addr */
+		size_t decode_rv64(addr_t &addr, addr_t end)
+		{
+			addr_t a = addr;
+			count = inst_fetch_batch(addr, end, inst, len, batch_size);
+			for (size_t i = 0; i < count; i++) {
+				pc[i] = a;
+				a += len[i];
+				decode_inst_rv64(dec[i], inst[i]);
+			}
+			return count;
+		}
+	};
+
+}
+
+#endif
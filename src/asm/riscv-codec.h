@@ -28,6 +28,11 @@
  *   template <typename T> inline void riscv::decode_inst_rv32(T &dec, riscv::inst_t inst)
  *   template <typename T> inline void riscv::decode_inst_rv64(T &dec, riscv::inst_t inst)
  *
+ * Compressed instructions are decoded and decompressed with a single load
+ * from a table indexed by the 16-bit parcel, built on first use.
+ *
+ *   template <typename T, bool rv32, bool rv64, ...> inline void riscv::decode_inst_rvc(T &dec, riscv::inst_t inst)
+ *
  * Encoding instructions
  * =====================
  * The encode function encodes the operands in struct riscv_decode using:
@@ -49,11 +54,32 @@
  * ========================
  * The compress functions work on an already decoded instruction and
  * they just set the op and codec field if the instruction is compressed.
- * Returns false if the instruction cannot be compressed.
+ * Returns false if the instruction cannot be compressed. The constraints
+ * are checked by a generated switch on the opcode that evaluates each
+ * candidate's constraints as one branch-free predicate.
  *
  *   template <typename T> inline bool riscv::compress_inst_rv32(T &dec)
  *   template <typename T> inline bool riscv::compress_inst_rv64(T &dec)
  *
+ * Compact decode
+ * ==============
+ * decode_compact is an 8 byte copy of the op, imm and register fields of
+ * a decoded instruction for interpreter caches.
+ *
+ *   template <typename T> riscv::decode_compact::decode_compact(const T &dec)
+ *
+ * Instruction properties
+ * ======================
+ * riscv_inst_props holds generated register operand masks, memory access
+ * class and width, control flow class and latency class for each opcode.
+ * The register functions return masks of the registers an instruction
+ * reads or writes, x0 is never included.
+ *
+ *   template <typename T> inline uint32_t riscv::inst_ireg_src(const T &dec)
+ *   template <typename T> inline uint32_t riscv::inst_ireg_dst(const T &dec)
+ *   template <typename T> inline uint32_t riscv::inst_freg_src(const T &dec)
+ *   template <typename T> inline uint32_t riscv::inst_freg_dst(const T &dec)
+ *
  */
 
 /*
@@ -90,6 +116,40 @@ namespace riscv
 			: imm(0), rd(0), rs1(0), rs2(0), rs3(0), op(0), codec(0), rm(0), aq(0), rl(0), pred(0), succ(0) {}
 	};
 
+	/*
+	 * Compact Decoded Instruction
+	 *
+	 * 8 byte form of a decoded instruction holding the fields used by the
+	 * interpreter, eight to a cache line. rs3 shares the immediate as the
+	 * R4 codec has no immediate; the other fields are recovered by
+	 * decoding the instruction again.
+	 */
+
+	struct decode_compact
+	{
+		union {
+			int32_t  imm;    /* decoded immediate */
+			uint8_t  rs3;    /* R4 codec */
+		};
+		uint8_t  rd;
+		uint8_t  rs1;
+		uint8_t  rs2;
+		uint8_t  op;
+
+		decode_compact() : imm(0), rd(0), rs1(0), rs2(0), op(0) {}
+
+		template <typename T>
+		explicit decode_compact(const T &dec) : imm(dec.imm), rd(dec.rd), rs1(dec.rs1), rs2(dec.rs2), op(dec.op)
+		{
+			if (dec.codec == riscv_codec_r4_m) {
+				imm = 0;
+				rs3 = dec.rs3;
+			}
+		}
+	};
+
+	static_assert(riscv_op_count <= 256, "riscv_op values must fit in decode_compact::op");
+
 
 	/* Instruction Length */
 
@@ -166,9 +226,65 @@ namespace riscv
 		decode_inst_type<T>(dec, inst);
 	}
 
+	/*
+	 * Compressed Instruction Table
+	 *
+	 * Decoded and decompressed form of every 16-bit parcel for one ISA
+	 * configuration, filled once from the switch decoder. Compressed
+	 * instructions never use rs3, rm, aq, rl, pred or succ.
+	 *
+	 *   imm[63:32] op[31:24] codec[23:16] rs2[14:10] rs1[9:5] rd[4:0]
+	 */
+
+	template <bool rv32, bool rv64, bool rvi, bool rvm, bool rva, bool rvs, bool rvf, bool rvd>
+	struct decode_rvc_table
+	{
+		enum { size = 65536 };
+
+		uint64_t ent[size];
+
+		decode_rvc_table()
+		{
+			for (inst_t inst = 0; inst < size; inst++) {
+				decode dec;
+				if ((inst & 0b11) != 0b11) {
+					decode_inst<decode,rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,true>(dec, inst);
+					if (rv32) decompress_inst_rv32<decode>(dec);
+					else decompress_inst_rv64<decode>(dec);
+				}
+				ent[inst] = (uint64_t(uint32_t(dec.imm)) << 32) | (uint64_t(dec.op) << 24) |
+					(uint64_t(dec.codec) << 16) | (uint64_t(dec.rs2) << 10) |
+					(uint64_t(dec.rs1) << 5) | uint64_t(dec.rd);
+			}
+		}
+
+		static const decode_rvc_table& get()
+		{
+			static const decode_rvc_table table;
+			return table;
+		}
+	};
+
+	template <typename T, bool rv32, bool rv64, bool rvi = true, bool rvm = true, bool rva = true, bool rvs = true, bool rvf = true, bool rvd = true, bool rvc = true>
+	inline void decode_inst_rvc(T &dec, inst_t inst)
+	{
+		static_assert(rvc, "decode_inst_rvc requires the C extension");
+		uint64_t ent = decode_rvc_table<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd>::get().ent[inst & 0xffff];
+		dec.imm = int32_t(ent >> 32);
+		dec.op = uint8_t(ent >> 24);
+		dec.codec = uint8_t(ent >> 16);
+		dec.rs2 = (ent >> 10) & 0x1f;
+		dec.rs1 = (ent >> 5) & 0x1f;
+		dec.rd = ent & 0x1f;
+	}
+
 	template <typename T>
 	inline void decode_inst_rv32(T &dec, inst_t inst)
 	{
+		if ((inst & 0b11) != 0b11) {
+			decode_inst_rvc<T,true,false>(dec, inst);
+			return;
+		}
 		decode_inst<T,true,false>(dec, inst);
 		decompress_inst_rv32<T>(dec);
 	}
@@ -176,6 +292,10 @@ namespace riscv
 	template <typename T>
 	inline void decode_inst_rv64(T &dec, inst_t inst)
 	{
+		if ((inst & 0b11) != 0b11) {
+			decode_inst_rvc<T,false,true>(dec, inst);
+			return;
+		}
 		decode_inst<T,false,true>(dec, inst);
 		decompress_inst_rv64<T>(dec);
 	}
@@ -186,17 +306,11 @@ namespace riscv
 	template <typename T>
 	inline bool decode_pseudo_inst(T &dec)
 	{
-		const riscv_comp_data *comp_data = riscv_inst_pseudo[dec.op];
-		if (!comp_data) return false;
-		while (comp_data->constraints) {
-			if (constraint_check(dec, comp_data->constraints)) {
-				dec.op = comp_data->op;
-				dec.codec = riscv_inst_codec[dec.op];
-				return true;
-			}
-			comp_data++;
-		}
-		return false;
+		int op = decode_pseudo_op(dec);
+		if (op == riscv_op_illegal) return false;
+		dec.op = op;
+		dec.codec = riscv_inst_codec[dec.op];
+		return true;
 	}
 
 
@@ -205,33 +319,53 @@ namespace riscv
 	template <typename T>
 	inline bool compress_inst_rv32(T &dec)
 	{
-		const riscv_comp_data *comp_data = riscv_inst_comp_rv32[dec.op];
-		if (!comp_data) return false;
-		while (comp_data->constraints) {
-			if (constraint_check(dec, comp_data->constraints)) {
-				dec.op = comp_data->op;
-				dec.codec = riscv_inst_codec[dec.op];
-				return true;
-			}
-			comp_data++;
-		}
-		return false;
+		int op = compress_op_rv32(dec);
+		if (op == riscv_op_illegal) return false;
+		dec.op = op;
+		dec.codec = riscv_inst_codec[dec.op];
+		return true;
 	}
 
 	template <typename T>
 	inline bool compress_inst_rv64(T &dec)
 	{
-		const riscv_comp_data *comp_data = riscv_inst_comp_rv64[dec.op];
-		if (!comp_data) return false;
-		while (comp_data->constraints) {
-			if (constraint_check(dec, comp_data->constraints)) {
-				dec.op = comp_data->op;
-				dec.codec = riscv_inst_codec[dec.op];
-				return true;
-			}
-			comp_data++;
-		}
-		return false;
+		int op = compress_op_rv64(dec);
+		if (op == riscv_op_illegal) return false;
+		dec.op = op;
+		dec.codec = riscv_inst_codec[dec.op];
+		return true;
+	}
+
+
+	/* Instruction Properties */
+
+	template <typename T>
+	inline uint32_t inst_ireg_src(const T &dec)
+	{
+		unsigned reg_src = riscv_inst_props[dec.op].reg_src;
+		return ((reg_src & riscv_reg_rs1 ? 1u << dec.rs1 : 0) |
+			(reg_src & riscv_reg_rs2 ? 1u << dec.rs2 : 0)) & ~1u;
+	}
+
+	template <typename T>
+	inline uint32_t inst_ireg_dst(const T &dec)
+	{
+		return (riscv_inst_props[dec.op].reg_dst & riscv_reg_rd ? 1u << dec.rd : 0) & ~1u;
+	}
+
+	template <typename T>
+	inline uint32_t inst_freg_src(const T &dec)
+	{
+		unsigned reg_src = riscv_inst_props[dec.op].reg_src;
+		return (reg_src & riscv_reg_frs1 ? 1u << dec.rs1 : 0) |
+			(reg_src & riscv_reg_frs2 ? 1u << dec.rs2 : 0) |
+			(reg_src & riscv_reg_frs3 ? 1u << dec.rs3 : 0);
+	}
+
+	template <typename T>
+	inline uint32_t inst_freg_dst(const T &dec)
+	{
+		return riscv_inst_props[dec.op].reg_dst & riscv_reg_frd ? 1u << dec.rd : 0;
 	}
 
 
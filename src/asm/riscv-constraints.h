@@ -61,6 +61,293 @@ inline bool constraint_check(T &dec, const rvc_constraint *c)
 	return true;
 }
 
+template <typename T>
+inline int decode_pseudo_op(T &dec)
+{
+	auto imm = dec.imm;
+	auto rd = dec.rd, rs1 = dec.rs1, rs2 = dec.rs2;
+	switch (dec.op) {
+		case riscv_op_jal:
+			if (rd == 0) return riscv_op_j;
+			if (rd == 1) return riscv_op_jal;
+			break;
+		case riscv_op_jalr:
+			if ((rd == 0) & (rs1 == 1)) return riscv_op_ret;
+			if ((rd == 0) & (imm == 0)) return riscv_op_jr;
+			if ((rd == 1) & (imm == 0)) return riscv_op_jalr;
+			break;
+		case riscv_op_beq:
+			if (rs2 == 0) return riscv_op_beqz;
+			break;
+		case riscv_op_bne:
+			if (rs2 == 0) return riscv_op_bnez;
+			break;
+		case riscv_op_blt:
+			if (rs2 == 0) return riscv_op_bltz;
+			if (rs1 == 0) return riscv_op_bgtz;
+			break;
+		case riscv_op_bge:
+			if (rs1 == 0) return riscv_op_blez;
+			if (rs2 == 0) return riscv_op_bgez;
+			break;
+		case riscv_op_addi:
+			if ((rd == 0) & (rs1 == 0) & (imm == 0)) return riscv_op_nop;
+			if (imm == 0) return riscv_op_mv;
+			if (rs1 == 0) return riscv_op_li;
+			break;
+		case riscv_op_sltiu:
+			if (imm == 1) return riscv_op_seqz;
+			break;
+		case riscv_op_xori:
+			if (imm == -1) return riscv_op_not;
+			break;
+		case riscv_op_sub:
+			if (rs1 == 0) return riscv_op_neg;
+			break;
+		case riscv_op_slt:
+			if (rs2 == 0) return riscv_op_sltz;
+			if (rs1 == 0) return riscv_op_sgtz;
+			break;
+		case riscv_op_sltu:
+			if (rs1 == 0) return riscv_op_snez;
+			break;
+		case riscv_op_addiw:
+			if (imm == 0) return riscv_op_sext_w;
+			break;
+		case riscv_op_subw:
+			if (rs1 == 0) return riscv_op_negw;
+			break;
+		case riscv_op_csrrw:
+			if (imm == 0x003) return riscv_op_fscsr;
+			if (imm == 0x002) return riscv_op_fsrm;
+			if (imm == 0x001) return riscv_op_fsflags;
+			break;
+		case riscv_op_csrrs:
+			if ((rs1 == 0) & (imm == 0xc00)) return riscv_op_rdcycle;
+			if ((rs1 == 0) & (imm == 0xc01)) return riscv_op_rdtime;
+			if ((rs1 == 0) & (imm == 0xc02)) return riscv_op_rdinstret;
+			if ((rs1 == 0) & (imm == 0xc80)) return riscv_op_rdcycleh;
+			if ((rs1 == 0) & (imm == 0xc81)) return riscv_op_rdtimeh;
+			if ((rs1 == 0) & (imm == 0xc80)) return riscv_op_rdinstreth;
+			if ((rs1 == 0) & (imm == 0x003)) return riscv_op_frcsr;
+			if ((rs1 == 0) & (imm == 0x002)) return riscv_op_frrm;
+			if ((rs1 == 0) & (imm == 0x001)) return riscv_op_frflags;
+			break;
+		case riscv_op_csrrwi:
+			if (imm == 0x002) return riscv_op_fsrmi;
+			if (imm == 0x001) return riscv_op_fsflagsi;
+			break;
+		case riscv_op_fsgnj_s:
+			if (rs2 == rs1) return riscv_op_fmv_s;
+			break;
+		case riscv_op_fsgnjn_s:
+			if (rs2 == rs1) return riscv_op_fneg_s;
+			break;
+		case riscv_op_fsgnjx_s:
+			if (rs2 == rs1) return riscv_op_fabs_s;
+			break;
+		case riscv_op_fsgnj_d:
+			if (rs2 == rs1) return riscv_op_fmv_d;
+			break;
+		case riscv_op_fsgnjn_d:
+			if (rs2 == rs1) return riscv_op_fneg_d;
+			break;
+		case riscv_op_fsgnjx_d:
+			if (rs2 == rs1) return riscv_op_fabs_d;
+			break;
+		default: break;
+	}
+	return riscv_op_illegal;
+}
+
+template <typename T>
+inline int compress_op_rv32(T &dec)
+{
+	auto imm = dec.imm;
+	auto rd = dec.rd, rs1 = dec.rs1, rs2 = dec.rs2;
+	switch (dec.op) {
+		case riscv_op_lui:
+			if ((imm <= 0b111111111111111111) & (imm != 0) & ((rd != 0) & (rd != 2))) return riscv_op_c_lui;
+			break;
+		case riscv_op_jal:
+			if ((imm <= 0b111111111111) & ((imm & 0b1) == 0) & (rd == 1)) return riscv_op_c_jal;
+			if ((imm <= 0b111111111111) & ((imm & 0b1) == 0) & (rd == 0)) return riscv_op_c_j;
+			break;
+		case riscv_op_jalr:
+			if ((rd == 0) & (rs1 != 0)) return riscv_op_c_jr;
+			if ((rd == 1) & (rs1 != 0)) return riscv_op_c_jalr;
+			break;
+		case riscv_op_beq:
+			if ((imm <= 0b111111111) & ((imm & 0b1) == 0) & (uint32_t(rs1) - 8u < 8u) & (rs2 == 0)) return riscv_op_c_beqz;
+			break;
+		case riscv_op_bne:
+			if ((imm <= 0b111111111) & ((imm & 0b1) == 0) & (uint32_t(rs1) - 8u < 8u) & (rs2 == 0)) return riscv_op_c_bnez;
+			break;
+		case riscv_op_lw:
+			if ((imm <= 0b1111111) & ((imm & 0b11) == 0) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_lw;
+			if ((imm <= 0b11111111) & ((imm & 0b11) == 0) & (rd != 0) & (rs1 == 2)) return riscv_op_c_lwsp;
+			break;
+		case riscv_op_sw:
+			if ((imm <= 0b1111111) & ((imm & 0b11) == 0) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_sw;
+			if ((imm <= 0b11111111) & ((imm & 0b11) == 0) & (rs1 == 2)) return riscv_op_c_swsp;
+			break;
+		case riscv_op_addi:
+			if ((imm <= 0b1111111111) & ((imm & 0b11) == 0) & (imm != 0) & (uint32_t(rd) - 8u < 8u) & (rs1 == 2)) return riscv_op_c_addi4spn;
+			if ((rd == 0) & (rs1 == 0) & (rs2 == 0)) return riscv_op_c_nop;
+			if ((uint32_t(imm) + 32u < 64u) & (rd != 0) & (rd == rs1)) return riscv_op_c_addi;
+			if ((imm <= 0b111111) & (rd != 0) & (rs1 == 0)) return riscv_op_c_li;
+			if ((imm <= 0b1111111111) & ((imm & 0b11) == 0) & (imm != 0) & (rd == 2) & (rs1 == 2)) return riscv_op_c_addi16sp;
+			break;
+		case riscv_op_andi:
+			if ((imm != 0) & (rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_andi;
+			break;
+		case riscv_op_slli_rv32i:
+			if ((imm != 0) & (rd != 0) & (rd == rs1)) return riscv_op_c_slli_rv32c;
+			break;
+		case riscv_op_srli_rv32i:
+			if ((imm != 0) & (rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_srli_rv32c;
+			break;
+		case riscv_op_srai_rv32i:
+			if ((imm != 0) & (rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_srai_rv32c;
+			break;
+		case riscv_op_add:
+			if ((rs1 == 0) & (rd != 0) & (rs2 != 0)) return riscv_op_c_mv;
+			if ((rd == rs1) & (rd != 0) & (rs2 != 0)) return riscv_op_c_add;
+			break;
+		case riscv_op_sub:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_sub;
+			break;
+		case riscv_op_xor:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_xor;
+			break;
+		case riscv_op_or:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_or;
+			break;
+		case riscv_op_and:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_and;
+			break;
+		case riscv_op_ebreak:
+			if (true) return riscv_op_c_ebreak;
+			break;
+		case riscv_op_flw:
+			if ((imm <= 0b1111111) & ((imm & 0b11) == 0) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_flw;
+			if ((imm <= 0b11111111) & ((imm & 0b11) == 0) & (rs1 == 2)) return riscv_op_c_flwsp;
+			break;
+		case riscv_op_fsw:
+			if ((imm <= 0b1111111) & ((imm & 0b11) == 0) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_fsw;
+			if ((imm <= 0b11111111) & ((imm & 0b11) == 0) & (rs1 == 2)) return riscv_op_c_fswsp;
+			break;
+		case riscv_op_fld:
+			if ((imm <= 0b11111111) & ((imm & 0b111) == 0) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_fld;
+			if ((imm <= 0b111111111) & ((imm & 0b111) == 0) & (rs1 == 2)) return riscv_op_c_fldsp;
+			break;
+		case riscv_op_fsd:
+			if ((imm <= 0b11111111) & ((imm & 0b111) == 0) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_fsd;
+			if ((imm <= 0b111111111) & ((imm & 0b111) == 0) & (rs1 == 2)) return riscv_op_c_fsdsp;
+			break;
+		default: break;
+	}
+	return riscv_op_illegal;
+}
+
+template <typename T>
+inline int compress_op_rv64(T &dec)
+{
+	auto imm = dec.imm;
+	auto rd = dec.rd, rs1 = dec.rs1, rs2 = dec.rs2;
+	switch (dec.op) {
+		case riscv_op_lui:
+			if ((imm <= 0b111111111111111111) & (imm != 0) & ((rd != 0) & (rd != 2))) return riscv_op_c_lui;
+			break;
+		case riscv_op_jal:
+			if ((imm <= 0b111111111111) & ((imm & 0b1) == 0) & (rd == 0)) return riscv_op_c_j;
+			break;
+		case riscv_op_jalr:
+			if ((rd == 0) & (rs1 != 0)) return riscv_op_c_jr;
+			if ((rd == 1) & (rs1 != 0)) return riscv_op_c_jalr;
+			break;
+		case riscv_op_beq:
+			if ((imm <= 0b111111111) & ((imm & 0b1) == 0) & (uint32_t(rs1) - 8u < 8u) & (rs2 == 0)) return riscv_op_c_beqz;
+			break;
+		case riscv_op_bne:
+			if ((imm <= 0b111111111) & ((imm & 0b1) == 0) & (uint32_t(rs1) - 8u < 8u) & (rs2 == 0)) return riscv_op_c_bnez;
+			break;
+		case riscv_op_lw:
+			if ((imm <= 0b1111111) & ((imm & 0b11) == 0) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_lw;
+			if ((imm <= 0b11111111) & ((imm & 0b11) == 0) & (rd != 0) & (rs1 == 2)) return riscv_op_c_lwsp;
+			break;
+		case riscv_op_sw:
+			if ((imm <= 0b1111111) & ((imm & 0b11) == 0) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_sw;
+			if ((imm <= 0b11111111) & ((imm & 0b11) == 0) & (rs1 == 2)) return riscv_op_c_swsp;
+			break;
+		case riscv_op_addi:
+			if ((imm <= 0b1111111111) & ((imm & 0b11) == 0) & (imm != 0) & (uint32_t(rd) - 8u < 8u) & (rs1 == 2)) return riscv_op_c_addi4spn;
+			if ((rd == 0) & (rs1 == 0) & (rs2 == 0)) return riscv_op_c_nop;
+			if ((uint32_t(imm) + 32u < 64u) & (rd != 0) & (rd == rs1)) return riscv_op_c_addi;
+			if ((imm <= 0b111111) & (rd != 0) & (rs1 == 0)) return riscv_op_c_li;
+			if ((imm <= 0b1111111111) & ((imm & 0b11) == 0) & (imm != 0) & (rd == 2) & (rs1 == 2)) return riscv_op_c_addi16sp;
+			break;
+		case riscv_op_andi:
+			if ((imm != 0) & (rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_andi;
+			break;
+		case riscv_op_add:
+			if ((rs1 == 0) & (rd != 0) & (rs2 != 0)) return riscv_op_c_mv;
+			if ((rd == rs1) & (rd != 0) & (rs2 != 0)) return riscv_op_c_add;
+			break;
+		case riscv_op_sub:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_sub;
+			break;
+		case riscv_op_xor:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_xor;
+			break;
+		case riscv_op_or:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_or;
+			break;
+		case riscv_op_and:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_and;
+			break;
+		case riscv_op_ld:
+			if ((imm <= 0b11111111) & ((imm & 0b111) == 0) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_ld;
+			if ((imm <= 0b111111111) & ((imm & 0b111) == 0) & (rd != 0) & (rs1 == 2)) return riscv_op_c_ldsp;
+			break;
+		case riscv_op_sd:
+			if ((imm <= 0b11111111) & ((imm & 0b111) == 0) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_sd;
+			if ((imm <= 0b111111111) & ((imm & 0b111) == 0) & (rs1 == 2)) return riscv_op_c_sdsp;
+			break;
+		case riscv_op_slli_rv64i:
+			if ((imm != 0) & (rd != 0) & (rd == rs1)) return riscv_op_c_slli_rv64c;
+			break;
+		case riscv_op_srli_rv64i:
+			if ((imm != 0) & (rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_srli_rv64c;
+			break;
+		case riscv_op_srai_rv64i:
+			if ((imm != 0) & (rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_srai_rv64c;
+			break;
+		case riscv_op_addiw:
+			if ((imm <= 0b111111) & (rd != 0) & (rd == rs1)) return riscv_op_c_addiw;
+			break;
+		case riscv_op_addw:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_addw;
+			break;
+		case riscv_op_subw:
+			if ((rd == rs1) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_subw;
+			break;
+		case riscv_op_ebreak:
+			if (true) return riscv_op_c_ebreak;
+			break;
+		case riscv_op_fld:
+			if ((imm <= 0b11111111) & ((imm & 0b111) == 0) & (uint32_t(rd) - 8u < 8u) & (uint32_t(rs1) - 8u < 8u)) return riscv_op_c_fld;
+			if ((imm <= 0b111111111) & ((imm & 0b111) == 0) & (rs1 == 2)) return riscv_op_c_fldsp;
+			break;
+		case riscv_op_fsd:
+			if ((imm <= 0b11111111) & ((imm & 0b111) == 0) & (uint32_t(rs1) - 8u < 8u) & (uint32_t(rs2) - 8u < 8u)) return riscv_op_c_fsd;
+			if ((imm <= 0b111111111) & ((imm & 0b111) == 0) & (rs1 == 2)) return riscv_op_c_fsdsp;
+			break;
+		default: break;
+	}
+	return riscv_op_illegal;
+}
+
 template <typename T>
 inline void constraint_set(T &dec, const rvc_constraint *c)
 {
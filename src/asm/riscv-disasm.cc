@@ -202,9 +202,9 @@ void riscv::disasm_inst_print(disasm &dec, std::deque<disasm> &dec_hist,
 	printf("\n");
 
 	// clear the instruction history on jump boundaries
-	switch(dec.op) {
-		case riscv_op_jal:
-		case riscv_op_jalr:
+	switch (riscv_inst_props[dec.op].flow) {
+		case riscv_flow_call:
+		case riscv_flow_call_indirect:
 			dec_hist.clear();
 			break;
 		default:
@@ -102,29 +102,15 @@ namespace riscv {
 	bool deocde_gprel(T &dec, addr_t &addr, addr_t gp)
 	{
 		if (!gp || dec.rs1 != riscv_ireg_gp) return false;
-		switch (dec.op) {
-			case riscv_op_addi:
-			case riscv_op_lb:
-			case riscv_op_lh:
-			case riscv_op_lw:
-			case riscv_op_ld:
-			case riscv_op_lbu:
-			case riscv_op_lhu:
-			case riscv_op_lwu:
-			case riscv_op_flw:
-			case riscv_op_fld:
-			case riscv_op_sb:
-			case riscv_op_sh:
-			case riscv_op_sw:
-			case riscv_op_sd:
-			case riscv_op_fsw:
-			case riscv_op_fsd:
-				addr = intptr_t(gp + dec.imm);
-				return true;
-			default:
+		switch (riscv_inst_props[dec.op].mem) {
+			case riscv_mem_load:
+			case riscv_mem_store:
 				break;
+			default:
+				if (dec.op != riscv_op_addi) return false;
 		}
-		return false;
+		addr = intptr_t(gp + dec.imm);
+		return true;
 	}
 
 	typedef std::function<const char*(addr_t, bool nearest)> symbol_name_fn;
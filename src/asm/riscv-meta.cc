@@ -1032,6 +1032,12 @@ const riscv_operand_data riscv_operands_sx_rd[] = {
 	{ riscv_operand_name_none, riscv_operand_type_none, riscv_primitive_none, riscv_type_none, 0 }
 };
 
+const riscv_operand_data riscv_operands_sx_rd_T_imm12[] = {
+	{ riscv_operand_name_rd, riscv_operand_type_ireg5, riscv_primitive_sx, riscv_type_ireg, 5 },
+	{ riscv_operand_name_imm12, riscv_operand_type_simm12, riscv_primitive_none, riscv_type_simm, 12 },
+	{ riscv_operand_name_none, riscv_operand_type_none, riscv_primitive_none, riscv_type_none, 0 }
+};
+
 const riscv_operand_data riscv_operands_sx_rd_T_imm20[] = {
 	{ riscv_operand_name_rd, riscv_operand_type_ireg5, riscv_primitive_sx, riscv_type_ireg, 5 },
 	{ riscv_operand_name_imm20, riscv_operand_type_simm32, riscv_primitive_none, riscv_type_simm, 32 },
@@ -1485,6 +1491,7 @@ const riscv_codec riscv_inst_codec[] = {
 	/*              fsflags */ riscv_codec_i,
 	/*                fsrmi */ riscv_codec_i,
 	/*             fsflagsi */ riscv_codec_i,
+	/*                   li */ riscv_codec_i,
 };
 
 const char* riscv_inst_format[] = {
@@ -1739,6 +1746,7 @@ const char* riscv_inst_format[] = {
 	/*              fsflags */ riscv_fmt_rd_rs1,
 	/*                fsrmi */ riscv_fmt_rd_zimm,
 	/*             fsflagsi */ riscv_fmt_rd_zimm,
+	/*                   li */ riscv_fmt_rd_imm,
 };
 
 const riscv_operand_data* riscv_inst_operand_data[] = {
@@ -1993,6 +2001,7 @@ const riscv_operand_data* riscv_inst_operand_data[] = {
 	/*              fsflags */ riscv_operands_sx_rd_sx_rs1,
 	/*                fsrmi */ riscv_operands_sx_rd_T_zimm,
 	/*             fsflagsi */ riscv_operands_sx_rd_T_zimm,
+	/*                   li */ riscv_operands_sx_rd_T_imm12,
 };
 
 const riscv::inst_t riscv_inst_match[] = {
@@ -2247,6 +2256,7 @@ const riscv::inst_t riscv_inst_match[] = {
 	/*              fsflags */ 0x0000000000000000,
 	/*                fsrmi */ 0x0000000000000000,
 	/*             fsflagsi */ 0x0000000000000000,
+	/*                   li */ 0x0000000000000000,
 };
 
 const riscv::inst_t riscv_inst_mask[] = {
@@ -2501,6 +2511,262 @@ const riscv::inst_t riscv_inst_mask[] = {
 	/*              fsflags */ 0x0000000000000000,
 	/*                fsrmi */ 0x0000000000000000,
 	/*             fsflagsi */ 0x0000000000000000,
+	/*                   li */ 0x0000000000000000,
+};
+
+const riscv_props_data riscv_inst_props[] = {
+	/*              unknown */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  lui */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                auipc */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  jal */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_call, riscv_latency_branch, 0, 0 },
+	/*                 jalr */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_call_indirect, riscv_latency_branch, 0, 0 },
+	/*                  beq */ { 0x06, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                  bne */ { 0x06, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                  blt */ { 0x06, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                  bge */ { 0x06, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                 bltu */ { 0x06, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                 bgeu */ { 0x06, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                   lb */ { 0x02, 0x01, riscv_mem_load, 1, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                   lh */ { 0x02, 0x01, riscv_mem_load, 2, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                   lw */ { 0x02, 0x01, riscv_mem_load, 4, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                  lbu */ { 0x02, 0x01, riscv_mem_load, 1, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                  lhu */ { 0x02, 0x01, riscv_mem_load, 2, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                   sb */ { 0x06, 0x00, riscv_mem_store, 1, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*                   sh */ { 0x06, 0x00, riscv_mem_store, 2, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*                   sw */ { 0x06, 0x00, riscv_mem_store, 4, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*                 addi */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 slti */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                sltiu */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 xori */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  ori */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 andi */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*           slli.rv32i */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*           srli.rv32i */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*           srai.rv32i */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  add */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  sub */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  sll */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  slt */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 sltu */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  xor */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  srl */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  sra */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                   or */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  and */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                fence */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*              fence.i */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                  lwu */ { 0x02, 0x01, riscv_mem_load, 4, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                   ld */ { 0x02, 0x01, riscv_mem_load, 8, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                   sd */ { 0x06, 0x00, riscv_mem_store, 8, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*           slli.rv64i */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*           srli.rv64i */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*           srai.rv64i */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                addiw */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                slliw */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                srliw */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                sraiw */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 addw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 subw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 sllw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 srlw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 sraw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  mul */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_mul, 0, 0 },
+	/*                 mulh */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_mul, 0, 0 },
+	/*               mulhsu */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_mul, 0, 0 },
+	/*                mulhu */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_mul, 0, 0 },
+	/*                  div */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                 divu */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                  rem */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                 remu */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                 mulw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_mul, 0, 0 },
+	/*                 divw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                divuw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                 remw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                remuw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_div, 0, 0 },
+	/*                 lr.w */ { 0x02, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*                 sc.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*            amoswap.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amoadd.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amoxor.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*              amoor.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amoand.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amomin.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amomax.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*            amominu.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*            amomaxu.w */ { 0x06, 0x01, riscv_mem_amo, 4, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*                 lr.d */ { 0x02, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*                 sc.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*            amoswap.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amoadd.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amoxor.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*              amoor.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amoand.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amomin.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*             amomax.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*            amominu.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*            amomaxu.d */ { 0x06, 0x01, riscv_mem_amo, 8, riscv_flow_none, riscv_latency_amo, 0, 0 },
+	/*                ecall */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*               ebreak */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*                 uret */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*                 sret */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*                 hret */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*                 mret */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*                 dret */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*            sfence.vm */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                  wfi */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                csrrw */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                csrrs */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                csrrc */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*               csrrwi */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*               csrrsi */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*               csrrci */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                  flw */ { 0x02, 0x10, riscv_mem_load, 4, riscv_flow_none, riscv_latency_load, 1, 0 },
+	/*                  fsw */ { 0x42, 0x00, riscv_mem_store, 4, riscv_flow_none, riscv_latency_store, 1, 0 },
+	/*              fmadd.s */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*              fmsub.s */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*             fnmsub.s */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*             fnmadd.s */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*               fadd.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fsub.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fmul.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fdiv.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fdiv, 1, 0 },
+	/*              fsgnj.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fsgnjn.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fsgnjx.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fmin.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fmax.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*              fsqrt.s */ { 0x20, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fdiv, 1, 0 },
+	/*                fle.s */ { 0x60, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*                flt.s */ { 0x60, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*                feq.s */ { 0x60, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.w.s */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.wu.s */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.s.w */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.s.wu */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*              fmv.x.s */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fclass.s */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*              fmv.s.x */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.l.s */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.lu.s */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.s.l */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.s.lu */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*                  fld */ { 0x02, 0x10, riscv_mem_load, 8, riscv_flow_none, riscv_latency_load, 1, 0 },
+	/*                  fsd */ { 0x42, 0x00, riscv_mem_store, 8, riscv_flow_none, riscv_latency_store, 1, 0 },
+	/*              fmadd.d */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*              fmsub.d */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*             fnmsub.d */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*             fnmadd.d */ { 0xe0, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fmadd, 1, 0 },
+	/*               fadd.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fsub.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fmul.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fdiv.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fdiv, 1, 0 },
+	/*              fsgnj.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fsgnjn.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fsgnjx.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fmin.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fmax.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.s.d */ { 0x20, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.d.s */ { 0x20, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*              fsqrt.d */ { 0x20, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fdiv, 1, 0 },
+	/*                fle.d */ { 0x60, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*                flt.d */ { 0x60, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*                feq.d */ { 0x60, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.w.d */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.wu.d */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.d.w */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.d.wu */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fclass.d */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.l.d */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.lu.d */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*              fmv.x.d */ { 0x20, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*             fcvt.d.l */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*            fcvt.d.lu */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*              fmv.d.x */ { 0x02, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*           c.addi4spn */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                c.fld */ { 0x02, 0x10, riscv_mem_load, 8, riscv_flow_none, riscv_latency_load, 1, 0 },
+	/*                 c.lw */ { 0x02, 0x01, riscv_mem_load, 4, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                c.flw */ { 0x02, 0x10, riscv_mem_load, 4, riscv_flow_none, riscv_latency_load, 1, 0 },
+	/*                c.fsd */ { 0x42, 0x00, riscv_mem_store, 8, riscv_flow_none, riscv_latency_store, 1, 0 },
+	/*                 c.sw */ { 0x06, 0x00, riscv_mem_store, 4, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*                c.fsw */ { 0x42, 0x00, riscv_mem_store, 4, riscv_flow_none, riscv_latency_store, 1, 0 },
+	/*                c.nop */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*               c.addi */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                c.jal */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_call, riscv_latency_branch, 0, 0 },
+	/*                 c.li */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*           c.addi16sp */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                c.lui */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*         c.srli.rv32c */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*         c.srai.rv32c */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*               c.andi */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                c.sub */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                c.xor */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 c.or */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                c.and */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*               c.subw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*               c.addw */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  c.j */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_jump, riscv_latency_branch, 0, 0 },
+	/*               c.beqz */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*               c.bnez */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*         c.slli.rv32c */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*              c.fldsp */ { 0x02, 0x10, riscv_mem_load, 8, riscv_flow_none, riscv_latency_load, 1, 0 },
+	/*               c.lwsp */ { 0x02, 0x01, riscv_mem_load, 4, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*              c.flwsp */ { 0x02, 0x10, riscv_mem_load, 4, riscv_flow_none, riscv_latency_load, 1, 0 },
+	/*                 c.jr */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_jump_indirect, riscv_latency_branch, 0, 0 },
+	/*                 c.mv */ { 0x04, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*             c.ebreak */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_trap, riscv_latency_system, 0, 0 },
+	/*               c.jalr */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_call_indirect, riscv_latency_branch, 0, 0 },
+	/*                c.add */ { 0x06, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*              c.fsdsp */ { 0x42, 0x00, riscv_mem_store, 8, riscv_flow_none, riscv_latency_store, 1, 0 },
+	/*               c.swsp */ { 0x06, 0x00, riscv_mem_store, 4, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*              c.fswsp */ { 0x42, 0x00, riscv_mem_store, 4, riscv_flow_none, riscv_latency_store, 1, 0 },
+	/*                 c.ld */ { 0x02, 0x01, riscv_mem_load, 8, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*                 c.sd */ { 0x06, 0x00, riscv_mem_store, 8, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*              c.addiw */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*         c.srli.rv64c */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*         c.srai.rv64c */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*         c.slli.rv64c */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*               c.ldsp */ { 0x02, 0x01, riscv_mem_load, 8, riscv_flow_none, riscv_latency_load, 0, 0 },
+	/*               c.sdsp */ { 0x06, 0x00, riscv_mem_store, 8, riscv_flow_none, riscv_latency_store, 0, 0 },
+	/*                  nop */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                   mv */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  not */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                  neg */ { 0x04, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 negw */ { 0x04, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*               sext.w */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 seqz */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 snez */ { 0x04, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 sltz */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                 sgtz */ { 0x04, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
+	/*                fmv.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fabs.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fneg.s */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*                fmv.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fabs.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*               fneg.d */ { 0x60, 0x10, riscv_mem_none, 0, riscv_flow_none, riscv_latency_fpu, 1, 0 },
+	/*                 beqz */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                 bnez */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                 blez */ { 0x04, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                 bgez */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                 bltz */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                 bgtz */ { 0x04, 0x00, riscv_mem_none, 0, riscv_flow_branch, riscv_latency_branch, 0, 0 },
+	/*                    j */ { 0x00, 0x00, riscv_mem_none, 0, riscv_flow_jump, riscv_latency_branch, 0, 0 },
+	/*                  ret */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_return, riscv_latency_branch, 0, 0 },
+	/*                   jr */ { 0x02, 0x00, riscv_mem_none, 0, riscv_flow_jump_indirect, riscv_latency_branch, 0, 0 },
+	/*              rdcycle */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*               rdtime */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*            rdinstret */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*             rdcycleh */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*              rdtimeh */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*           rdinstreth */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                frcsr */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                 frrm */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*              frflags */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                fscsr */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                 fsrm */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*              fsflags */ { 0x02, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                fsrmi */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*             fsflagsi */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_system, 0, 0 },
+	/*                   li */ { 0x00, 0x01, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 },
 };
 
 const rvc_constraint rvcc_jal[] = {
@@ -2542,7 +2808,7 @@ const rvc_constraint rvcc_negw[] = {
 };
 
 const rvc_constraint rvcc_sext_w[] = {
-	rvc_rs2_eq_x0,
+	rvc_imm_eq_zero,
 	rvc_end
 };
 
@@ -2722,6 +2988,11 @@ const rvc_constraint rvcc_fsflagsi[] = {
 	rvc_end
 };
 
+const rvc_constraint rvcc_li[] = {
+	rvc_rs1_eq_x0,
+	rvc_end
+};
+
 
 const riscv_comp_data rvcp_jal[] = {
 	{ riscv_op_j, rvcc_j },
@@ -2761,6 +3032,7 @@ const riscv_comp_data rvcp_bge[] = {
 const riscv_comp_data rvcp_addi[] = {
 	{ riscv_op_nop, rvcc_nop },
 	{ riscv_op_mv, rvcc_mv },
+	{ riscv_op_li, rvcc_li },
 	{ riscv_op_illegal, nullptr }
 };
 
@@ -3109,6 +3381,7 @@ const riscv_comp_data* riscv_inst_pseudo[] = {
 	/*              fsflags */ nullptr,
 	/*                fsrmi */ nullptr,
 	/*             fsflagsi */ nullptr,
+	/*                   li */ nullptr,
 };
 
 const riscv_comp_data riscv_inst_depseudo[] = {
@@ -3363,6 +3636,7 @@ const riscv_comp_data riscv_inst_depseudo[] = {
 	/*              fsflags */ { riscv_op_csrrw, rvcc_fsflags },
 	/*                fsrmi */ { riscv_op_csrrwi, rvcc_fsrmi },
 	/*             fsflagsi */ { riscv_op_csrrwi, rvcc_fsflagsi },
+	/*                   li */ { riscv_op_addi, rvcc_li },
 };
 
 const riscv_comp_data* riscv_inst_comp_rv32[] = {
@@ -3617,6 +3891,7 @@ const riscv_comp_data* riscv_inst_comp_rv32[] = {
 	/*              fsflags */ nullptr,
 	/*                fsrmi */ nullptr,
 	/*             fsflagsi */ nullptr,
+	/*                   li */ nullptr,
 };
 
 const riscv_comp_data* riscv_inst_comp_rv64[] = {
@@ -3871,6 +4146,7 @@ const riscv_comp_data* riscv_inst_comp_rv64[] = {
 	/*              fsflags */ nullptr,
 	/*                fsrmi */ nullptr,
 	/*             fsflagsi */ nullptr,
+	/*                   li */ nullptr,
 };
 
 const int riscv_inst_decomp_rv32[] = {
@@ -4125,6 +4401,7 @@ const int riscv_inst_decomp_rv32[] = {
 	/*              fsflags */ riscv_op_illegal,
 	/*                fsrmi */ riscv_op_illegal,
 	/*             fsflagsi */ riscv_op_illegal,
+	/*                   li */ riscv_op_illegal,
 };
 
 const int riscv_inst_decomp_rv64[] = {
@@ -4379,5 +4656,6 @@ const int riscv_inst_decomp_rv64[] = {
 	/*              fsflags */ riscv_op_illegal,
 	/*                fsrmi */ riscv_op_illegal,
 	/*             fsflagsi */ riscv_op_illegal,
+	/*                   li */ riscv_op_illegal,
 };
 
@@ -169,6 +169,53 @@ enum riscv_intr
 	riscv_intr_m_external = 11,         /* Machine external interrupt */
 };
 
+enum riscv_reg
+{
+	riscv_reg_rd = 1,                   /* Integer destination register */
+	riscv_reg_rs1 = 2,                  /* Integer source register 1 */
+	riscv_reg_rs2 = 4,                  /* Integer source register 2 */
+	riscv_reg_rs3 = 8,                  /* Integer source register 3 */
+	riscv_reg_frd = 16,                 /* Floating point destination register */
+	riscv_reg_frs1 = 32,                /* Floating point source register 1 */
+	riscv_reg_frs2 = 64,                /* Floating point source register 2 */
+	riscv_reg_frs3 = 128,               /* Floating point source register 3 */
+};
+
+enum riscv_mem
+{
+	riscv_mem_none = 0,                 /* No memory access */
+	riscv_mem_load = 1,                 /* Load */
+	riscv_mem_store = 2,                /* Store */
+	riscv_mem_amo = 3,                  /* Atomic memory operation or reservation */
+};
+
+enum riscv_flow
+{
+	riscv_flow_none = 0,                /* Sequential */
+	riscv_flow_branch = 1,              /* Conditional branch */
+	riscv_flow_jump = 2,                /* Direct jump */
+	riscv_flow_jump_indirect = 3,       /* Indirect jump */
+	riscv_flow_call = 4,                /* Direct jump and link */
+	riscv_flow_call_indirect = 5,       /* Indirect jump and link */
+	riscv_flow_return = 6,              /* Return */
+	riscv_flow_trap = 7,                /* Environment call, breakpoint or trap return */
+};
+
+enum riscv_latency
+{
+	riscv_latency_alu = 0,              /* Integer arithmetic and logic */
+	riscv_latency_mul = 1,              /* Integer multiply */
+	riscv_latency_div = 2,              /* Integer divide and remainder */
+	riscv_latency_load = 3,             /* Load */
+	riscv_latency_store = 4,            /* Store */
+	riscv_latency_amo = 5,              /* Atomic memory operation */
+	riscv_latency_branch = 6,           /* Branch and jump */
+	riscv_latency_fpu = 7,              /* Floating point arithmetic, compare, convert and move */
+	riscv_latency_fmadd = 8,            /* Floating point fused multiply add */
+	riscv_latency_fdiv = 9,             /* Floating point divide and square root */
+	riscv_latency_system = 10,          /* System and control status register */
+};
+
 enum rvc_constraint
 {
 	rvc_end,
@@ -287,6 +334,26 @@ enum riscv_csr
 	riscv_csr_mibound = 0x383,          /* Instruction bound register */
 	riscv_csr_mdbase = 0x384,           /* Data base register */
 	riscv_csr_mdbound = 0x385,          /* Data bound register */
+	riscv_csr_pmpcfg0 = 0x3A0,          /* Physical memory protection configuration */
+	riscv_csr_pmpcfg1 = 0x3A1,          /* Physical memory protection configuration, RV32 only */
+	riscv_csr_pmpcfg2 = 0x3A2,          /* Physical memory protection configuration */
+	riscv_csr_pmpcfg3 = 0x3A3,          /* Physical memory protection configuration, RV32 only */
+	riscv_csr_pmpaddr0 = 0x3B0,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr1 = 0x3B1,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr2 = 0x3B2,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr3 = 0x3B3,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr4 = 0x3B4,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr5 = 0x3B5,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr6 = 0x3B6,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr7 = 0x3B7,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr8 = 0x3B8,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr9 = 0x3B9,         /* Physical memory protection address register */
+	riscv_csr_pmpaddr10 = 0x3BA,        /* Physical memory protection address register */
+	riscv_csr_pmpaddr11 = 0x3BB,        /* Physical memory protection address register */
+	riscv_csr_pmpaddr12 = 0x3BC,        /* Physical memory protection address register */
+	riscv_csr_pmpaddr13 = 0x3BD,        /* Physical memory protection address register */
+	riscv_csr_pmpaddr14 = 0x3BE,        /* Physical memory protection address register */
+	riscv_csr_pmpaddr15 = 0x3BF,        /* Physical memory protection address register */
 	riscv_csr_mcycle = 0xF00,           /* Machine cycle counter */
 	riscv_csr_mtime = 0xF01,            /* Machine wall-clock time */
 	riscv_csr_minstret = 0xF02,         /* Machine instructions-retired counter */
@@ -845,8 +912,15 @@ enum riscv_op
 	riscv_op_fsflags = 248,            	/* Set FP Accrued Exception Flags */
 	riscv_op_fsrmi = 249,              	/* Set FP Rounding Mode Immediate */
 	riscv_op_fsflagsi = 250,           	/* Set FP Accrued Exception Flags Immediate */
+	riscv_op_li = 251,                 	/* Load immediate */
 };
 
+enum { riscv_op_count = 252 };
+
+/* Metadata digest, changes whenever the generated tables may change */
+
+static const unsigned long long riscv_meta_digest = 0xc1e087d61b2aac40ULL;
+
 /* Primitive data structure */
 
 struct riscv_primitive_data
@@ -862,6 +936,19 @@ struct riscv_comp_data
 	const rvc_constraint* constraints;
 };
 
+/* Instruction property structure */
+struct riscv_props_data
+{
+	const unsigned char reg_src;     /* riscv_reg mask of register operands read */
+	const unsigned char reg_dst;     /* riscv_reg mask of register operands written */
+	const unsigned char mem;         /* riscv_mem class */
+	const unsigned char mem_width;   /* memory access width in bytes */
+	const unsigned char flow;        /* riscv_flow class */
+	const unsigned char latency;     /* riscv_latency class */
+	const unsigned char fp;          /* uses floating point registers */
+	const unsigned char reserved;
+};
+
 /* Instruction operand structure */
 struct riscv_operand_data
 {
@@ -881,6 +968,7 @@ extern const riscv::inst_t riscv_inst_match[];
 extern const riscv::inst_t riscv_inst_mask[];
 extern const riscv_comp_data* riscv_inst_pseudo[];
 extern const riscv_comp_data riscv_inst_depseudo[];
+extern const riscv_props_data riscv_inst_props[];
 extern const riscv_comp_data* riscv_inst_comp_rv32[];
 extern const riscv_comp_data* riscv_inst_comp_rv64[];
 extern const int riscv_inst_decomp_rv32[];
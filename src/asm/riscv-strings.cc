@@ -328,6 +328,7 @@ const char* riscv_inst_name_sym[] = {
 	"fsflags",
 	"fsrmi",
 	"fsflagsi",
+	"li",
 };
 
 const char* riscv_operand_name_sym[] = {
@@ -1343,6 +1344,10 @@ const char* riscv_csr_name_sym[] = {
 	nullptr,
 	nullptr,
 	nullptr,
+	"pmpcfg0",
+	"pmpcfg1",
+	"pmpcfg2",
+	"pmpcfg3",
 	nullptr,
 	nullptr,
 	nullptr,
@@ -1355,26 +1360,22 @@ const char* riscv_csr_name_sym[] = {
 	nullptr,
 	nullptr,
 	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
-	nullptr,
+	"pmpaddr0",
+	"pmpaddr1",
+	"pmpaddr2",
+	"pmpaddr3",
+	"pmpaddr4",
+	"pmpaddr5",
+	"pmpaddr6",
+	"pmpaddr7",
+	"pmpaddr8",
+	"pmpaddr9",
+	"pmpaddr10",
+	"pmpaddr11",
+	"pmpaddr12",
+	"pmpaddr13",
+	"pmpaddr14",
+	"pmpaddr15",
 	nullptr,
 	nullptr,
 	nullptr,
@@ -0,0 +1,4235 @@
+//
+//  riscv-table.h
+//
+//  DANGER - This is machine generated code
+//
+
+#ifndef riscv_table_h
+#define riscv_table_h
+
+/* Decode Table Nodes */
+
+enum { decode_table_link = 0x8000 };
+
+struct decode_table_node
+{
+	uint8_t  shift1;    /* index = ((inst >> shift1) & mask1) | ((inst >> shift2) & mask2) */
+	uint8_t  shift2;
+	uint16_t base;      /* first entry */
+	uint32_t mask1;
+	uint32_t mask2;
+	uint16_t count;     /* number of keys in a sparse node, 0 if dense */
+	uint16_t key_base;  /* first key of a sparse node */
+};
+
+static const decode_table_node decode_table_nodes[] = {
+	{  6,  0,     0, 0x00000380, 0x0000007f,   0,   0 }, /* inst[15:13|6:0] */
+	{  2,  0,  1024, 0x000007ff, 0x00000000,   0,   0 }, /* inst[12:2] */
+	{ 12,  0,  3072, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  3080, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  3088, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 23, 12,  3096, 0x000001f8, 0x00000007,   0,   0 }, /* inst[31:26|14:12] */
+	{ 22, 12,  3608, 0x000003f8, 0x00000007,   0,   0 }, /* inst[31:25|14:12] */
+	{ 12,  0,  4632, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  4640, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 24, 12,  4648, 0x000000f8, 0x00000007,   0,   0 }, /* inst[31:27|14:12] */
+	{ 20,  0,  4904, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 20,  0,  4936, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 22, 12,  4968, 0x000003f8, 0x00000007,   0,   0 }, /* inst[31:25|14:12] */
+	{ 22, 12,  5992, 0x000003f8, 0x00000007,   0,   0 }, /* inst[31:25|14:12] */
+	{ 25,  0,  7016, 0x00000003, 0x00000000,   0,   0 }, /* inst[26:25] */
+	{ 25,  0,  7020, 0x00000003, 0x00000000,   0,   0 }, /* inst[26:25] */
+	{ 25,  0,  7024, 0x00000003, 0x00000000,   0,   0 }, /* inst[26:25] */
+	{ 25,  0,  7028, 0x00000003, 0x00000000,   0,   0 }, /* inst[26:25] */
+	{ 25,  0,  7032, 0x0000007f, 0x00000000,   0,   0 }, /* inst[31:25] */
+	{ 12,  0,  7160, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  7168, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  7176, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  7184, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 20,  0,  7192, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 20,  0,  7224, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 20,  0,  7256, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 20,  0,  7288, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 12,  0,  7320, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  7328, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 20,  0,  7336, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 20,  0,  7368, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 20,  0,  7400, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 20,  0,  7432, 0x0000001f, 0x00000000,   0,   0 }, /* inst[24:20] */
+	{ 17, 12,  7464, 0x000000f8, 0x00000007,   0,   0 }, /* inst[24:20|14:12] */
+	{ 17, 12,  7720, 0x000000f8, 0x00000007,   0,   0 }, /* inst[24:20|14:12] */
+	{ 17, 12,  7976, 0x000000f8, 0x00000007,   0,   0 }, /* inst[24:20|14:12] */
+	{ 17, 12,  8232, 0x000000f8, 0x00000007,   0,   0 }, /* inst[24:20|14:12] */
+	{ 12,  0,  8488, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  8496, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 12,  0,  8504, 0x00000007, 0x00000000,   0,   0 }, /* inst[14:12] */
+	{ 15,  7,  8512, 0x0001ffe0, 0x0000001f,   9,   0 }, /* inst[31:20|11:7] */
+	{ 15,  0,  8522, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{ 15,  0,  8554, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{ 15,  0,  8586, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{ 15,  0,  8618, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{ 15,  0,  8650, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{ 15,  0,  8682, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{ 15,  0,  8714, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{ 15,  0,  8746, 0x0000001f, 0x00000000,   0,   0 }, /* inst[19:15] */
+	{  7,  0,  8778, 0x0000001f, 0x00000000,   0,   0 }, /* inst[11:7] */
+	{  8,  5,  8810, 0x0000001c, 0x00000003,   0,   0 }, /* inst[12:10|6:5] */
+	{  2,  0,  8842, 0x000007ff, 0x00000000,   0,   0 }, /* inst[12:2] */
+};
+
+static const uint32_t decode_table_keys[] = {
+	0,
+	32,
+	64,
+	8256,
+	8320,
+	8352,
+	16448,
+	24640,
+	63040,
+};
+
+/* Decode Table Entries */
+
+template <bool rv32, bool rv64, bool rvi, bool rvm, bool rva, bool rvs, bool rvf, bool rvd, bool rvc>
+struct decode_table
+{
+	static const uint16_t ent[10890];
+};
+
+template <bool rv32, bool rv64, bool rvi, bool rvm, bool rva, bool rvs, bool rvf, bool rvd, bool rvc>
+const uint16_t decode_table<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,rvc>::ent[10890] = {
+	/* node 0 inst[15:13|6:0] */
+	rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 2, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 3, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 4, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 5, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	rvi ? riscv_op_auipc : riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal,
+	decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 6, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 7, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 8, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 9, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 12, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	rvi ? riscv_op_lui : riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal,
+	decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 13, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 14, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 15, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 16, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 17, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 18, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 37, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 38, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	rvi ? riscv_op_jal : riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal,
+	decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	decode_table_link | 39, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_addi4spn : riscv_op_illegal, decode_table_link | 1,
+	rvc && rv32 ? riscv_op_c_slli_rv32c : rvc && rv64 ? riscv_op_c_slli_rv64c : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 2,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 3,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 4,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 5,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, rvi ? riscv_op_auipc : riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 6,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 7,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 8,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 9,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 12,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, rvi ? riscv_op_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 13,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 14,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 15,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 16,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 17,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 18,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 37,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 38,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, rvi ? riscv_op_jal : riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, decode_table_link | 39,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fld : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_jal : rvc && rv64 ? riscv_op_c_addiw : riscv_op_illegal,
+	rvc ? riscv_op_c_fldsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 2, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 3, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 4,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 5,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, rvi ? riscv_op_auipc : riscv_op_illegal,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 6,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 7, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 8, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 9,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 12,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, rvi ? riscv_op_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 13,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 14, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 15, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 16, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 17, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 18, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 37,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, decode_table_link | 38,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	rvi ? riscv_op_jal : riscv_op_illegal, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal,
+	decode_table_link | 39, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_lw : riscv_op_illegal, rvc ? riscv_op_c_li : riscv_op_illegal,
+	rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_lw : riscv_op_illegal,
+	rvc ? riscv_op_c_li : riscv_op_illegal, rvc ? riscv_op_c_lwsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 2,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 3,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 4,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 5,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	rvi ? riscv_op_auipc : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 6,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 7,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 8,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 9,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 12,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	rvi ? riscv_op_lui : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 13,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 14,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 15,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 16,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 17,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 18,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 37,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 38,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	rvi ? riscv_op_jal : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal,
+	decode_table_link | 39,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_flw : rvc && rv64 ? riscv_op_c_ld : riscv_op_illegal,
+	decode_table_link | 49,
+	rvc && rv32 ? riscv_op_c_flwsp : rvc && rv64 ? riscv_op_c_ldsp : riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, decode_table_link | 2,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, decode_table_link | 3,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, decode_table_link | 4,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, decode_table_link | 5,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51,
+	rvi ? riscv_op_auipc : riscv_op_illegal, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, decode_table_link | 6, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, riscv_op_illegal, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, decode_table_link | 7, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, decode_table_link | 8, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, riscv_op_illegal, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, decode_table_link | 9, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, decode_table_link | 12, riscv_op_illegal, decode_table_link | 50,
+	decode_table_link | 51, rvi ? riscv_op_lui : riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 13, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 14, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 15, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 16, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 17, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 18, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 37, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, decode_table_link | 38, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 50, decode_table_link | 51, rvi ? riscv_op_jal : riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, decode_table_link | 39,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 50, decode_table_link | 51, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 2,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 3,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 4,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 5,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, rvi ? riscv_op_auipc : riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 6,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 7,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 8,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 9,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 12,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, rvi ? riscv_op_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 13,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 14,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 15,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 16,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 17,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 18,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 37,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 38,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, rvi ? riscv_op_jal : riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, decode_table_link | 39,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc ? riscv_op_c_fsd : riscv_op_illegal, rvc ? riscv_op_c_j : riscv_op_illegal,
+	rvc ? riscv_op_c_fsdsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 2, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 3, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 4,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 5,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, rvi ? riscv_op_auipc : riscv_op_illegal,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 6,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 7, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 8, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 9,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 12,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, rvi ? riscv_op_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 13,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 14, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 15, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 16, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 17, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 18, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 37,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, decode_table_link | 38,
+	rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	rvi ? riscv_op_jal : riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	decode_table_link | 39, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal, rvc ? riscv_op_c_beqz : riscv_op_illegal,
+	rvc ? riscv_op_c_swsp : riscv_op_illegal, riscv_op_illegal, rvc ? riscv_op_c_sw : riscv_op_illegal,
+	rvc ? riscv_op_c_beqz : riscv_op_illegal, rvc ? riscv_op_c_swsp : riscv_op_illegal,
+	riscv_op_illegal, rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 2,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 3,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 4,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 5,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	rvi ? riscv_op_auipc : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 6,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 7,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 8,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 9,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 12,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	rvi ? riscv_op_lui : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 13,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 14,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 15,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 16,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 17,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 18,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 37,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 38,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	rvi ? riscv_op_jal : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal,
+	decode_table_link | 39,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fsw : rvc && rv64 ? riscv_op_c_sd : riscv_op_illegal,
+	rvc ? riscv_op_c_bnez : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_fswsp : rvc && rv64 ? riscv_op_c_sdsp : riscv_op_illegal, riscv_op_illegal,
+	/* node 1 inst[12:2] */
+	rvc ? riscv_op_c_nop : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	rvc ? riscv_op_c_addi : riscv_op_illegal, rvc ? riscv_op_c_addi : riscv_op_illegal,
+	/* node 2 inst[14:12] */
+	rvi ? riscv_op_lb : riscv_op_illegal, rvi ? riscv_op_lh : riscv_op_illegal,
+	rvi ? riscv_op_lw : riscv_op_illegal, rvi && rv64 ? riscv_op_ld : riscv_op_illegal,
+	rvi ? riscv_op_lbu : riscv_op_illegal, rvi ? riscv_op_lhu : riscv_op_illegal,
+	rvi && rv64 ? riscv_op_lwu : riscv_op_illegal, riscv_op_illegal,
+	/* node 3 inst[14:12] */
+	riscv_op_illegal, riscv_op_illegal, rvf ? riscv_op_flw : riscv_op_illegal,
+	rvd ? riscv_op_fld : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 4 inst[14:12] */
+	rvi ? riscv_op_fence : riscv_op_illegal, rvi ? riscv_op_fence_i : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 5 inst[31:26|14:12] */
+	rvi ? riscv_op_addi : riscv_op_illegal,
+	rvi && rv32 ? riscv_op_slli_rv32i : rvi && rv64 ? riscv_op_slli_rv64i : riscv_op_illegal,
+	rvi ? riscv_op_slti : riscv_op_illegal, rvi ? riscv_op_sltiu : riscv_op_illegal,
+	rvi ? riscv_op_xori : riscv_op_illegal,
+	rvi && rv32 ? riscv_op_srli_rv32i : rvi && rv64 ? riscv_op_srli_rv64i : riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal,
+	rvi && rv32 ? riscv_op_srai_rv32i : rvi && rv64 ? riscv_op_srai_rv64i : riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	rvi ? riscv_op_addi : riscv_op_illegal, riscv_op_illegal, rvi ? riscv_op_slti : riscv_op_illegal,
+	rvi ? riscv_op_sltiu : riscv_op_illegal, rvi ? riscv_op_xori : riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_ori : riscv_op_illegal, rvi ? riscv_op_andi : riscv_op_illegal,
+	/* node 6 inst[31:25|14:12] */
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, rvi && rv64 ? riscv_op_slliw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_srliw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_addiw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_sraiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_addiw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 7 inst[14:12] */
+	rvi ? riscv_op_sb : riscv_op_illegal, rvi ? riscv_op_sh : riscv_op_illegal,
+	rvi ? riscv_op_sw : riscv_op_illegal, rvi && rv64 ? riscv_op_sd : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 8 inst[14:12] */
+	riscv_op_illegal, riscv_op_illegal, rvf ? riscv_op_fsw : riscv_op_illegal,
+	rvd ? riscv_op_fsd : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 9 inst[31:27|14:12] */
+	riscv_op_illegal, riscv_op_illegal, rva ? riscv_op_amoadd_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amoadd_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rva ? riscv_op_amoswap_w : riscv_op_illegal, rva && rv64 ? riscv_op_amoswap_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 10, decode_table_link | 11, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rva ? riscv_op_sc_w : riscv_op_illegal, rva && rv64 ? riscv_op_sc_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, rva ? riscv_op_amoxor_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amoxor_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, rva ? riscv_op_amoor_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amoor_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, rva ? riscv_op_amoand_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amoand_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, rva ? riscv_op_amomin_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amomin_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, rva ? riscv_op_amomax_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amomax_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, rva ? riscv_op_amominu_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amominu_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, rva ? riscv_op_amomaxu_w : riscv_op_illegal,
+	rva && rv64 ? riscv_op_amomaxu_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 10 inst[24:20] */
+	rva ? riscv_op_lr_w : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 11 inst[24:20] */
+	rva && rv64 ? riscv_op_lr_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 12 inst[31:25|14:12] */
+	rvi ? riscv_op_add : riscv_op_illegal, rvi ? riscv_op_sll : riscv_op_illegal,
+	rvi ? riscv_op_slt : riscv_op_illegal, rvi ? riscv_op_sltu : riscv_op_illegal,
+	rvi ? riscv_op_xor : riscv_op_illegal, rvi ? riscv_op_srl : riscv_op_illegal,
+	rvi ? riscv_op_or : riscv_op_illegal, rvi ? riscv_op_and : riscv_op_illegal,
+	rvm ? riscv_op_mul : riscv_op_illegal, rvm ? riscv_op_mulh : riscv_op_illegal,
+	rvm ? riscv_op_mulhsu : riscv_op_illegal, rvm ? riscv_op_mulhu : riscv_op_illegal,
+	rvm ? riscv_op_div : riscv_op_illegal, rvm ? riscv_op_divu : riscv_op_illegal,
+	rvm ? riscv_op_rem : riscv_op_illegal, rvm ? riscv_op_remu : riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi ? riscv_op_sub : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, rvi ? riscv_op_sra : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 13 inst[31:25|14:12] */
+	rvi && rv64 ? riscv_op_addw : riscv_op_illegal, rvi && rv64 ? riscv_op_sllw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_srlw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvm && rv64 ? riscv_op_mulw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, rvm && rv64 ? riscv_op_divw : riscv_op_illegal,
+	rvm && rv64 ? riscv_op_divuw : riscv_op_illegal, rvm && rv64 ? riscv_op_remw : riscv_op_illegal,
+	rvm && rv64 ? riscv_op_remuw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvi && rv64 ? riscv_op_subw : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvi && rv64 ? riscv_op_sraw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 14 inst[26:25] */
+	rvf ? riscv_op_fmadd_s : riscv_op_illegal, rvd ? riscv_op_fmadd_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 15 inst[26:25] */
+	rvf ? riscv_op_fmsub_s : riscv_op_illegal, rvd ? riscv_op_fmsub_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 16 inst[26:25] */
+	rvf ? riscv_op_fnmsub_s : riscv_op_illegal, rvd ? riscv_op_fnmsub_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 17 inst[26:25] */
+	rvf ? riscv_op_fnmadd_s : riscv_op_illegal, rvd ? riscv_op_fnmadd_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 18 inst[31:25] */
+	rvf ? riscv_op_fadd_s : riscv_op_illegal, rvd ? riscv_op_fadd_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvf ? riscv_op_fsub_s : riscv_op_illegal,
+	rvd ? riscv_op_fsub_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	rvf ? riscv_op_fmul_s : riscv_op_illegal, rvd ? riscv_op_fmul_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, rvf ? riscv_op_fdiv_s : riscv_op_illegal,
+	rvd ? riscv_op_fdiv_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 19, decode_table_link | 20, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 21, decode_table_link | 22, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, decode_table_link | 23,
+	decode_table_link | 24, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 25, decode_table_link | 26, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, decode_table_link | 27,
+	decode_table_link | 28, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	decode_table_link | 29, decode_table_link | 30, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, decode_table_link | 31,
+	decode_table_link | 32, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, decode_table_link | 33, decode_table_link | 34,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, decode_table_link | 35, decode_table_link | 36, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 19 inst[14:12] */
+	rvf ? riscv_op_fsgnj_s : riscv_op_illegal, rvf ? riscv_op_fsgnjn_s : riscv_op_illegal,
+	rvf ? riscv_op_fsgnjx_s : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 20 inst[14:12] */
+	rvd ? riscv_op_fsgnj_d : riscv_op_illegal, rvd ? riscv_op_fsgnjn_d : riscv_op_illegal,
+	rvd ? riscv_op_fsgnjx_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 21 inst[14:12] */
+	rvf ? riscv_op_fmin_s : riscv_op_illegal, rvf ? riscv_op_fmax_s : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 22 inst[14:12] */
+	rvd ? riscv_op_fmin_d : riscv_op_illegal, rvd ? riscv_op_fmax_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 23 inst[24:20] */
+	riscv_op_illegal, rvd ? riscv_op_fcvt_s_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 24 inst[24:20] */
+	rvd ? riscv_op_fcvt_d_s : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 25 inst[24:20] */
+	rvf ? riscv_op_fsqrt_s : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 26 inst[24:20] */
+	rvd ? riscv_op_fsqrt_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 27 inst[14:12] */
+	rvf ? riscv_op_fle_s : riscv_op_illegal, rvf ? riscv_op_flt_s : riscv_op_illegal,
+	rvf ? riscv_op_feq_s : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 28 inst[14:12] */
+	rvd ? riscv_op_fle_d : riscv_op_illegal, rvd ? riscv_op_flt_d : riscv_op_illegal,
+	rvd ? riscv_op_feq_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 29 inst[24:20] */
+	rvf ? riscv_op_fcvt_w_s : riscv_op_illegal, rvf ? riscv_op_fcvt_wu_s : riscv_op_illegal,
+	rvf && rv64 ? riscv_op_fcvt_l_s : riscv_op_illegal,
+	rvf && rv64 ? riscv_op_fcvt_lu_s : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 30 inst[24:20] */
+	rvd ? riscv_op_fcvt_w_d : riscv_op_illegal, rvd ? riscv_op_fcvt_wu_d : riscv_op_illegal,
+	rvd && rv64 ? riscv_op_fcvt_l_d : riscv_op_illegal,
+	rvd && rv64 ? riscv_op_fcvt_lu_d : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 31 inst[24:20] */
+	rvf ? riscv_op_fcvt_s_w : riscv_op_illegal, rvf ? riscv_op_fcvt_s_wu : riscv_op_illegal,
+	rvf && rv64 ? riscv_op_fcvt_s_l : riscv_op_illegal,
+	rvf && rv64 ? riscv_op_fcvt_s_lu : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 32 inst[24:20] */
+	rvd ? riscv_op_fcvt_d_w : riscv_op_illegal, rvd ? riscv_op_fcvt_d_wu : riscv_op_illegal,
+	rvd && rv64 ? riscv_op_fcvt_d_l : riscv_op_illegal,
+	rvd && rv64 ? riscv_op_fcvt_d_lu : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal,
+	/* node 33 inst[24:20|14:12] */
+	rvf ? riscv_op_fmv_x_s : riscv_op_illegal, rvf ? riscv_op_fclass_s : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 34 inst[24:20|14:12] */
+	rvd && rv64 ? riscv_op_fmv_x_d : riscv_op_illegal, rvd ? riscv_op_fclass_d : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 35 inst[24:20|14:12] */
+	rvf ? riscv_op_fmv_s_x : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 36 inst[24:20|14:12] */
+	rvd && rv64 ? riscv_op_fmv_d_x : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 37 inst[14:12] */
+	rvi ? riscv_op_beq : riscv_op_illegal, rvi ? riscv_op_bne : riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, rvi ? riscv_op_blt : riscv_op_illegal, rvi ? riscv_op_bge : riscv_op_illegal,
+	rvi ? riscv_op_bltu : riscv_op_illegal, rvi ? riscv_op_bgeu : riscv_op_illegal,
+	/* node 38 inst[14:12] */
+	rvi ? riscv_op_jalr : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 39 inst[14:12] */
+	decode_table_link | 40, rvs ? riscv_op_csrrw : riscv_op_illegal,
+	rvs ? riscv_op_csrrs : riscv_op_illegal, rvs ? riscv_op_csrrc : riscv_op_illegal, riscv_op_illegal,
+	rvs ? riscv_op_csrrwi : riscv_op_illegal, rvs ? riscv_op_csrrsi : riscv_op_illegal,
+	rvs ? riscv_op_csrrci : riscv_op_illegal,
+	/* node 40 inst[31:20|11:7] */
+	decode_table_link | 41, decode_table_link | 42, decode_table_link | 43, decode_table_link | 44,
+	rvs ? riscv_op_sfence_vm : riscv_op_illegal, decode_table_link | 45, decode_table_link | 46,
+	decode_table_link | 47, decode_table_link | 48, riscv_op_illegal,
+	/* node 41 inst[19:15] */
+	rvs ? riscv_op_ecall : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 42 inst[19:15] */
+	rvs ? riscv_op_ebreak : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 43 inst[19:15] */
+	rvs ? riscv_op_uret : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 44 inst[19:15] */
+	rvs ? riscv_op_sret : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 45 inst[19:15] */
+	rvs ? riscv_op_wfi : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 46 inst[19:15] */
+	rvs ? riscv_op_hret : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 47 inst[19:15] */
+	rvs ? riscv_op_mret : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 48 inst[19:15] */
+	rvs ? riscv_op_dret : riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal, riscv_op_illegal,
+	/* node 49 inst[11:7] */
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_addi16sp : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	rvc ? riscv_op_c_lui : riscv_op_illegal, rvc ? riscv_op_c_lui : riscv_op_illegal,
+	/* node 50 inst[12:10|6:5] */
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc ? riscv_op_c_andi : riscv_op_illegal, rvc ? riscv_op_c_andi : riscv_op_illegal,
+	rvc ? riscv_op_c_andi : riscv_op_illegal, rvc ? riscv_op_c_andi : riscv_op_illegal,
+	rvc ? riscv_op_c_sub : riscv_op_illegal, rvc ? riscv_op_c_xor : riscv_op_illegal,
+	rvc ? riscv_op_c_or : riscv_op_illegal, rvc ? riscv_op_c_and : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srli_rv32c : rvc && rv64 ? riscv_op_c_srli_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc && rv32 ? riscv_op_c_srai_rv32c : rvc && rv64 ? riscv_op_c_srai_rv64c : riscv_op_illegal,
+	rvc ? riscv_op_c_andi : riscv_op_illegal, rvc ? riscv_op_c_andi : riscv_op_illegal,
+	rvc ? riscv_op_c_andi : riscv_op_illegal, rvc ? riscv_op_c_andi : riscv_op_illegal,
+	rvc ? riscv_op_c_subw : riscv_op_illegal, rvc ? riscv_op_c_addw : riscv_op_illegal,
+	riscv_op_illegal, riscv_op_illegal,
+	/* node 51 inst[12:2] */
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_jr : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_mv : riscv_op_illegal, rvc ? riscv_op_c_mv : riscv_op_illegal,
+	rvc ? riscv_op_c_ebreak : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_jalr : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+	rvc ? riscv_op_c_add : riscv_op_illegal, rvc ? riscv_op_c_add : riscv_op_illegal,
+};
+
+/* Decode Instruction Opcode using the Decode Table */
+
+template <bool rv32, bool rv64, bool rvi, bool rvm, bool rva, bool rvs, bool rvf, bool rvd, bool rvc>
+inline opcode_t decode_inst_op_table(riscv::inst_t inst)
+{
+	const uint16_t *ent = decode_table<rv32,rv64,rvi,rvm,rva,rvs,rvf,rvd,rvc>::ent;
+	const decode_table_node *node = decode_table_nodes;
+	for (;;) {
+		uint32_t idx = ((inst >> node->shift1) & node->mask1) | ((inst >> node->shift2) & node->mask2);
+		uint16_t e;
+		if (node->count == 0) {
+			e = ent[node->base + idx];
+		} else {
+			size_t i = 0;
+			while (i < node->count && decode_table_keys[node->key_base + i] != idx) i++;
+			e = ent[node->base + i];
+		}
+		if (!(e & decode_table_link)) return e;
+		node = decode_table_nodes + (e & ~decode_table_link);
+	}
+}
+
+#endif
@@ -205,6 +205,129 @@ namespace riscv {
 		return s.x = x;
 	}
 
+	/*
+	 * Immediate bit chunk and pext/pdep chains
+	 *
+	 * An immediate is a list of chunks, each a contiguous run of
+	 * instruction bits copied to a contiguous run of immediate bits.
+	 * Chunks are grouped into chains whose instruction and immediate
+	 * bit order agree, so each chain decodes with one pext and pdep.
+	 */
+
+	struct imm_chunk
+	{
+		int inst_lsb;
+		int imm_lsb;
+		int width;
+	};
+
+	enum { imm_max_chunks = 16, imm_max_chains = 4 };
+
+	struct imm_chains
+	{
+		int count;                           /* 0 if there are too many chains */
+		u64 inst_mask[imm_max_chains];       /* instruction bits of each chain */
+		u64 imm_mask[imm_max_chains];        /* immediate bits of each chain */
+	};
+
+	template <typename I>
+	constexpr imm_chains imm_operand_chains()
+	{
+		imm_chunk c[imm_max_chunks] = {};
+		int n = I::chunks(c, 0);
+
+		/* sort by instruction bit position */
+		for (int i = 1; i < n; i++) {
+			for (int j = i; j > 0 && c[j - 1].inst_lsb > c[j].inst_lsb; j--) {
+				imm_chunk t = c[j]; c[j] = c[j - 1]; c[j - 1] = t;
+			}
+		}
+
+		/* first fit gives the minimum number of increasing chains */
+		imm_chains r = {};
+		int last[imm_max_chains] = {};
+		for (int i = 0; i < n; i++) {
+			u64 inst_mask = ((u64(1) << c[i].width) - 1) << c[i].inst_lsb;
+			u64 imm_mask = ((u64(1) << c[i].width) - 1) << c[i].imm_lsb;
+			int k = 0;
+			while (k < r.count && last[k] > c[i].imm_lsb) k++;
+			if (k == imm_max_chains) return imm_chains{};
+			if (k == r.count) r.count++;
+			r.inst_mask[k] |= inst_mask;
+			r.imm_mask[k] |= imm_mask;
+			last[k] = c[i].imm_lsb;
+		}
+		return r;
+	}
+
+	/*
+	 * BMI2 operand decode
+	 *
+	 * Scattered immediates use pext/pdep when the binary is built for
+	 * BMI2 or when a program sets imm_operand_host<>::bmi2 from the
+	 * host_cpu caps at startup.
+	 */
+
+	#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+	#define RISCV_IMM_BMI2 1
+	#define RISCV_IMM_BMI2_TARGET __attribute__((target("bmi2")))
+	#else
+	#define RISCV_IMM_BMI2 0
+	#endif
+
+	template <typename T = void>
+	struct imm_operand_host
+	{
+		static bool bmi2;
+	};
+
+	#if defined __BMI2__
+	template <typename T> bool imm_operand_host<T>::bmi2 = true;
+	#else
+	template <typename T> bool imm_operand_host<T>::bmi2 = false;
+	#endif
+
+	#if RISCV_IMM_BMI2
+	/* move the bits of src_mask to dst_mask, a shift when either side is contiguous */
+	RISCV_IMM_BMI2_TARGET inline u64 imm_move_bits(u64 v, u64 src_mask, u64 dst_mask)
+	{
+		u64 src_lsb = src_mask & -src_mask, dst_lsb = dst_mask & -dst_mask;
+		if (((src_mask + src_lsb) & src_mask) == 0 && ((dst_mask + dst_lsb) & dst_mask) == 0) {
+			int shift = __builtin_ctzll(dst_mask) - __builtin_ctzll(src_mask);
+			return (shift < 0 ? v >> -shift : v << shift) & dst_mask;
+		}
+		if (((dst_mask + dst_lsb) & dst_mask) == 0) {
+			return __builtin_ia32_pext_di(v, src_mask) << __builtin_ctzll(dst_mask);
+		}
+		if (((src_mask + src_lsb) & src_mask) == 0) {
+			return __builtin_ia32_pdep_di(v >> __builtin_ctzll(src_mask), dst_mask);
+		}
+		return __builtin_ia32_pdep_di(__builtin_ia32_pext_di(v, src_mask), dst_mask);
+	}
+
+	template <typename I>
+	RISCV_IMM_BMI2_TARGET inline u64 imm_decode_pext(u64 inst)
+	{
+		constexpr imm_chains ch = imm_operand_chains<I>();
+		u64 imm = 0;
+		for (int i = 0; i < ch.count; i++) {
+			imm |= imm_move_bits(inst, ch.inst_mask[i], ch.imm_mask[i]);
+		}
+		return imm;
+	}
+
+	template <typename I>
+	RISCV_IMM_BMI2_TARGET inline u64 imm_encode_pdep(u64 imm)
+	{
+		constexpr imm_chains ch = imm_operand_chains<I>();
+		u64 inst = 0;
+		for (int i = 0; i < ch.count; i++) {
+			inst |= imm_move_bits(imm, ch.imm_mask[i], ch.inst_mask[i]);
+		}
+		return inst;
+	}
+	#endif
+
 	/*
 	 * Bit range template
 	 *
@@ -243,6 +366,7 @@ namespace riscv {
 
 		static inline constexpr u64 decode(u64 inst) { return 0; }
 		static inline constexpr u64 encode(u64 imm) { return 0; }
+		static inline constexpr int chunks(imm_chunk *c, int n) { return n; }
 	};
 
 	template<int K, int L, typename H, typename... T>
@@ -265,6 +389,11 @@ namespace riscv {
 			const u64 mask = ((u64(1) << (H::n + 1)) - 1) ^ ((u64(1) << H::m) - 1);
 			return ((shift < 0 ? (imm & mask) >> -shift : (imm & mask) << shift)) | I::encode(imm);
 		}
+
+		static inline constexpr int chunks(imm_chunk *c, int n) {
+			c[n] = imm_chunk{ L + I::offset, H::m, H::width };
+			return I::chunks(c, n + 1);
+		}
 	};
 
 	/*
@@ -282,6 +411,7 @@ namespace riscv {
 	{
 		static inline constexpr R decode(u64 inst) { return 0; }
 		static inline constexpr R encode(u64 imm) { return 0; }
+		static inline constexpr int chunks(imm_chunk *c, int n) { return n; }
 	};
 
 	template<typename R, int W, typename H, typename... T>
@@ -291,15 +421,46 @@ namespace riscv {
 
 		static inline constexpr R decode(u64 inst) { return I::decode(inst) | H::decode(inst); }
 		static inline constexpr R encode(u64 imm) { return I::encode(imm) | H::encode(imm); }
+		static inline constexpr int chunks(imm_chunk *c, int n) { return I::chunks(c, H::chunks(c, n)); }
 	};
 
+	/*
+	 * Each chunk costs a shift, mask and or on the portable path. pext
+	 * and pdep share one port on current cores, so they only pay off
+	 * when a chain replaces several chunks (e.g. cimmj: 8 chunks in 3
+	 * chains); other operands keep the portable path.
+	 */
+
+	template<typename I>
+	inline constexpr bool imm_operand_bmi2()
+	{
+		imm_chunk c[imm_max_chunks] = {};
+		int chains = imm_operand_chains<I>().count;
+		return chains > 0 && I::chunks(c, 0) >= 2 * chains + 2;
+	}
+
 	template<int W, typename... Args>
 	struct simm_operand_t : imm_operand_impl_t<s64,W,Args...>
 	{
 		typedef imm_operand_impl_t<s64,W,Args...> I;
 
-		static constexpr s64 decode(u64 inst) { return sign_extend<s64,W>(I::decode(inst)); }
-		static constexpr s64 encode(u64 imm) { return I::encode(imm); }
+		static inline s64 decode(u64 inst) {
+	#if RISCV_IMM_BMI2
+			if (imm_operand_bmi2<I>() && imm_operand_host<>::bmi2) {
+				return sign_extend<s64,W>(imm_decode_pext<I>(inst));
+			}
+	#endif
+			return sign_extend<s64,W>(I::decode(inst));
+		}
+
+		static inline s64 encode(u64 imm) {
+	#if RISCV_IMM_BMI2
+			if (imm_operand_bmi2<I>() && imm_operand_host<>::bmi2) {
+				return imm_encode_pdep<I>(imm);
+			}
+	#endif
+			return I::encode(imm);
+		}
 	};
 
 	template<int W, typename... Args>
@@ -307,8 +468,23 @@ namespace riscv {
 	{
 		typedef imm_operand_impl_t<u64,W,Args...> I;
 
-		static constexpr u64 decode(u64 inst) { return I::decode(inst); }
-		static constexpr u64 encode(u64 imm) { return I::encode(imm); }
+		static inline u64 decode(u64 inst) {
+	#if RISCV_IMM_BMI2
+			if (imm_operand_bmi2<I>() && imm_operand_host<>::bmi2) {
+				return imm_decode_pext<I>(inst);
+			}
+	#endif
+			return I::decode(inst);
+		}
+
+		static inline u64 encode(u64 imm) {
+	#if RISCV_IMM_BMI2
+			if (imm_operand_bmi2<I>() && imm_operand_host<>::bmi2) {
+				return imm_encode_pdep<I>(imm);
+			}
+	#endif
+			return I::encode(imm);
+		}
 	};
 
 }
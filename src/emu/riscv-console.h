@@ -0,0 +1,191 @@
+//
+//  riscv-console.h
+//
+
+#ifndef riscv_console_h
+#define riscv_console_h
+
+namespace riscv {
+
+	/* write a buffer to a host file descriptor, retrying partial writes */
+	inline void console_write_fd(int fd, const char *buf, size_t len)
+	{
+		size_t off = 0;
+		while (off < len) {
+			ssize_t ret = ::write(fd, buf + off, len - off);
+			if (ret < 0) {
+				if (errno == EINTR) continue;
+				debug("console: error: write: %s", strerror(errno));
+				break;
+			}
+			off += ret;
+		}
+	}
+
+
+	/*
+	 * console_writer
+	 *
+	 * buffered console output that batches guest output into host writes
+	 *
+	 * The emulated hart appends bytes to a single producer, single consumer
+	 * ring buffer and a background thread writes them to the host fd. The
+	 * thread is started by the first byte of output and sleeps while the
+	 * ring is empty. Once output is pending it is written when a newline
+	 * is written, when the ring passes flush_size or after at most
+	 * flush_deadline_ms. A full ring blocks the producer until space is
+	 * available so no output is dropped.
+	 */
+
+	template <const size_t ring_size = 16384, const size_t flush_size = 4096,
+		const int flush_deadline_ms = 10>
+	struct console_writer
+	{
+		static_assert(ispow2(ring_size), "ring_size must be a power of 2");
+		static_assert(flush_size <= ring_size, "flush_size must not exceed ring_size");
+
+		int fd;                           /* host output file descriptor */
+		char ring[ring_size];             /* output ring buffer */
+		std::atomic<size_t> head;         /* consumer position */
+		std::atomic<size_t> tail;         /* producer position */
+		std::atomic<bool> running;
+		std::mutex lock;
+		std::condition_variable wakeup;
+		std::condition_variable drained;
+		std::thread writer;
+
+		/* statistics */
+		std::atomic<u64> write_count;     /* host writes */
+		std::atomic<u64> byte_count;      /* bytes written */
+
+		console_writer(int fd = fileno(stdout)) :
+			fd(fd), head(0), tail(0), running(true), write_count(0), byte_count(0) {}
+
+		~console_writer()
+		{
+			if (!writer.joinable()) return;
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				running = false;
+			}
+			wakeup.notify_one();
+			writer.join();
+		}
+
+		void putchar(u8 ch)
+		{
+			if (!writer.joinable()) {
+				writer = std::thread(&console_writer::writer_thread, this);
+			}
+			size_t t = tail.load(std::memory_order_relaxed);
+			size_t h = head.load(std::memory_order_acquire);
+			if (t - h == ring_size) {
+				std::unique_lock<std::mutex> guard(lock);
+				wakeup.notify_one();
+				drained.wait(guard, [&] { return t - head.load() < ring_size; });
+			}
+			ring[t & (ring_size - 1)] = ch;
+
+			/*
+			 * head is re-read after the tail store (both sequentially consistent,
+			 * as is the writer's head store) so either the writer sees the new
+			 * tail before it sleeps or we see it caught up to the old tail. If
+			 * it caught up it may be going idle, so notify under the lock so the
+			 * wakeup can not fall between its check and its wait. Flush triggers
+			 * are sent the same way so they are not lost in that window either.
+			 */
+			tail.store(t + 1);
+			h = head.load();
+			if (h == t || ch == '\n' || t + 1 - h >= flush_size) {
+				std::lock_guard<std::mutex> guard(lock);
+				wakeup.notify_one();
+			}
+		}
+
+		/* block until all pending output has been written */
+		void flush()
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			wakeup.notify_one();
+			drained.wait(guard, [&] { return head.load() == tail.load(); });
+		}
+
+	private:
+		void write_pending()
+		{
+			size_t h = head.load(std::memory_order_relaxed);
+			size_t t = tail.load(std::memory_order_acquire);
+			while (h != t) {
+				/* write up to the end of the ring, then wrap */
+				size_t off = h & (ring_size - 1);
+				size_t len = std::min(t - h, ring_size - off);
+				console_write_fd(fd, ring + off, len);
+				write_count++;
+				byte_count += len;
+				h += len;
+			}
+			head.store(h);
+		}
+
+		void writer_thread()
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			while (running) {
+				wakeup.wait(guard, [&] { return !running || head.load() != tail.load(); });
+				if (!running) break;
+				if (ring[(tail.load() - 1) & (ring_size - 1)] != '\n') {
+					wakeup.wait_for(guard, std::chrono::milliseconds(flush_deadline_ms));
+				}
+				guard.unlock();
+				write_pending();
+				guard.lock();
+				drained.notify_all();
+			}
+			guard.unlock();
+			write_pending();
+		}
+	};
+
+
+	/*
+	 * console_reader
+	 *
+	 * non-blocking console input, polled by the emulator at block
+	 * boundaries so the hart never blocks in a host read
+	 */
+
+	template <const size_t ring_size = 256>
+	struct console_reader
+	{
+		static_assert(ispow2(ring_size), "ring_size must be a power of 2");
+
+		int fd;                          /* host input file descriptor */
+		u8 ring[ring_size];              /* input ring buffer */
+		size_t head;                     /* next byte to be read by the guest */
+		size_t tail;                     /* next free slot */
+
+		console_reader(int fd = fileno(stdin)) : fd(fd), head(0), tail(0) {}
+
+		/* read available host input into the ring without blocking */
+		void poll()
+		{
+			size_t space = ring_size - (tail - head);
+			struct pollfd pfd = { fd, POLLIN, 0 };
+			if (space == 0 || ::poll(&pfd, 1, 0) != 1 || !(pfd.revents & POLLIN)) return;
+			size_t off = tail & (ring_size - 1);
+			ssize_t ret = ::read(fd, ring + off, std::min(space, ring_size - off));
+			if (ret > 0) tail += ret;
+		}
+
+		bool available() { return head != tail; }
+
+		/* returns the next input byte or -1 if there is no input */
+		int getchar()
+		{
+			return head == tail ? -1 : ring[head++ & (ring_size - 1)];
+		}
+	};
+
+}
+
+#endif
@@ -20,12 +20,12 @@ riscv::addr_t exec_inst_rv32(T &dec, P &proc, riscv::addr_t pc_offset)
 	switch (dec.op) {
 		case riscv_op_lui:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = dec.imm;
+				proc.ireg[dec.rd] = dec.imm;
 			};
 			break;
 		case riscv_op_auipc:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = proc.pc + dec.imm;
+				proc.ireg[dec.rd] = proc.pc + dec.imm;
 			};
 			break;
 		case riscv_op_jal:
@@ -110,137 +110,137 @@ riscv::addr_t exec_inst_rv32(T &dec, P &proc, riscv::addr_t pc_offset)
 			break;
 		case riscv_op_addi:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(dec.imm);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(dec.imm);
 			};
 			break;
 		case riscv_op_slti:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(dec.imm);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(dec.imm);
 			};
 			break;
 		case riscv_op_sltiu:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(dec.imm);
 			};
 			break;
 		case riscv_op_xori:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(dec.imm);
 			};
 			break;
 		case riscv_op_ori:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(dec.imm);
 			};
 			break;
 		case riscv_op_andi:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(dec.imm);
 			};
 			break;
 		case riscv_op_slli_rv32i:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << dec.imm;
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << dec.imm;
 			};
 			break;
 		case riscv_op_srli_rv32i:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> dec.imm;
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> dec.imm;
 			};
 			break;
 		case riscv_op_srai_rv32i:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> dec.imm;
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> dec.imm;
 			};
 			break;
 		case riscv_op_add:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_sub:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) - sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) - sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_sll:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << (proc.ireg[dec.rs2] & 0b1111111);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << (proc.ireg[dec.rs2] & 0b1111111);
 			};
 			break;
 		case riscv_op_slt:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_sltu:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_xor:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_srl:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
 			};
 			break;
 		case riscv_op_sra:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
 			};
 			break;
 		case riscv_op_or:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_and:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_mul:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) * sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) * sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_mulh:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = riscv::mulh(sx(proc.ireg[dec.rs1]), sx(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = riscv::mulh(sx(proc.ireg[dec.rs1]), sx(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_mulhsu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = riscv::mulhsu(sx(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = riscv::mulhsu(sx(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_mulhu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = riscv::mulhu(ux(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = riscv::mulhu(ux(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_div:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? std::numeric_limits<sx>::min() : sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(proc.ireg[dec.rs1]) / sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? std::numeric_limits<sx>::min() : sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(proc.ireg[dec.rs1]) / sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_divu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(ux(proc.ireg[dec.rs1]) / ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(ux(proc.ireg[dec.rs1]) / ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_rem:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? 0 : sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(proc.ireg[dec.rs1]) % sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? 0 : sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(proc.ireg[dec.rs1]) % sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_remu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(ux(proc.ireg[dec.rs1]) % ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(ux(proc.ireg[dec.rs1]) % ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_lr_w:
@@ -558,6 +558,96 @@ riscv::addr_t exec_inst_rv32(T &dec, P &proc, riscv::addr_t pc_offset)
 				if (dec.rd > 0) proc.ireg[dec.rd] = f64_classify(proc.freg[dec.rs1].r.d.val);
 			};
 			break;
+		case riscv_op_nop:
+			if (rvi) {
+				pc_offset = pc_offset;
+			};
+			break;
+		case riscv_op_mv:
+			if (rvi) {
+				proc.ireg[dec.rd] = proc.ireg[dec.rs1];
+			};
+			break;
+		case riscv_op_not:
+			if (rvi) {
+				proc.ireg[dec.rd] = ~ux(proc.ireg[dec.rs1]);
+			};
+			break;
+		case riscv_op_neg:
+			if (rvi) {
+				proc.ireg[dec.rd] = -ux(proc.ireg[dec.rs2]);
+			};
+			break;
+		case riscv_op_seqz:
+			if (rvi) {
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) == 0;
+			};
+			break;
+		case riscv_op_snez:
+			if (rvi) {
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs2]) != 0;
+			};
+			break;
+		case riscv_op_sltz:
+			if (rvi) {
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < 0;
+			};
+			break;
+		case riscv_op_sgtz:
+			if (rvi) {
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) > 0;
+			};
+			break;
+		case riscv_op_beqz:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) == 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bnez:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) != 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_blez:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs2]) <= 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bgez:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) >= 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bltz:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) < 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bgtz:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs2]) > 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_j:
+			if (rvi) {
+				pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_ret:
+			if (rvi) {
+				pc_offset = proc.ireg[dec.rs1] + dec.imm - proc.pc;
+			};
+			break;
+		case riscv_op_jr:
+			if (rvi) {
+				pc_offset = proc.ireg[dec.rs1] - proc.pc;
+			};
+			break;
+		case riscv_op_li:
+			if (rvi) {
+				proc.ireg[dec.rd] = sx(dec.imm);
+			};
+			break;
 		default: return 0; /* illegal instruction */
 	}
 	return pc_offset;
@@ -576,12 +666,12 @@ riscv::addr_t exec_inst_rv64(T &dec, P &proc, riscv::addr_t pc_offset)
 	switch (dec.op) {
 		case riscv_op_lui:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = dec.imm;
+				proc.ireg[dec.rd] = dec.imm;
 			};
 			break;
 		case riscv_op_auipc:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = proc.pc + dec.imm;
+				proc.ireg[dec.rd] = proc.pc + dec.imm;
 			};
 			break;
 		case riscv_op_jal:
@@ -666,82 +756,82 @@ riscv::addr_t exec_inst_rv64(T &dec, P &proc, riscv::addr_t pc_offset)
 			break;
 		case riscv_op_addi:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(dec.imm);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(dec.imm);
 			};
 			break;
 		case riscv_op_slti:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(dec.imm);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(dec.imm);
 			};
 			break;
 		case riscv_op_sltiu:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(dec.imm);
 			};
 			break;
 		case riscv_op_xori:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(dec.imm);
 			};
 			break;
 		case riscv_op_ori:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(dec.imm);
 			};
 			break;
 		case riscv_op_andi:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(dec.imm);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(dec.imm);
 			};
 			break;
 		case riscv_op_add:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) + sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_sub:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) - sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) - sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_sll:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << (proc.ireg[dec.rs2] & 0b1111111);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << (proc.ireg[dec.rs2] & 0b1111111);
 			};
 			break;
 		case riscv_op_slt:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_sltu:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) < ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_xor:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) ^ ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_srl:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
 			};
 			break;
 		case riscv_op_sra:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b1111111);
 			};
 			break;
 		case riscv_op_or:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) | ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_and:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) & ux(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_lwu:
@@ -761,127 +851,127 @@ riscv::addr_t exec_inst_rv64(T &dec, P &proc, riscv::addr_t pc_offset)
 			break;
 		case riscv_op_slli_rv64i:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << dec.imm;
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) << dec.imm;
 			};
 			break;
 		case riscv_op_srli_rv64i:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> dec.imm;
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) >> dec.imm;
 			};
 			break;
 		case riscv_op_srai_rv64i:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> dec.imm;
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) >> dec.imm;
 			};
 			break;
 		case riscv_op_addiw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(s32(proc.ireg[dec.rs1]) + sx(dec.imm));
+				proc.ireg[dec.rd] = s32(s32(proc.ireg[dec.rs1]) + sx(dec.imm));
 			};
 			break;
 		case riscv_op_slliw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) << dec.imm);
+				proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) << dec.imm);
 			};
 			break;
 		case riscv_op_srliw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) >> dec.imm);
+				proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) >> dec.imm);
 			};
 			break;
 		case riscv_op_sraiw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) >> dec.imm;
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) >> dec.imm;
 			};
 			break;
 		case riscv_op_addw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) + s32(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) + s32(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_subw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) - s32(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) - s32(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_sllw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) << (proc.ireg[dec.rs2] & 0b11111));
+				proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) << (proc.ireg[dec.rs2] & 0b11111));
 			};
 			break;
 		case riscv_op_srlw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b11111));
+				proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b11111));
 			};
 			break;
 		case riscv_op_sraw:
 			if (rvi) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b11111);
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) >> (proc.ireg[dec.rs2] & 0b11111);
 			};
 			break;
 		case riscv_op_mul:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) * sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) * sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_mulh:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = riscv::mulh(sx(proc.ireg[dec.rs1]), sx(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = riscv::mulh(sx(proc.ireg[dec.rs1]), sx(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_mulhsu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = riscv::mulhsu(sx(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = riscv::mulhsu(sx(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_mulhu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = riscv::mulhu(ux(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = riscv::mulhu(ux(proc.ireg[dec.rs1]), ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_div:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? std::numeric_limits<sx>::min() : sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(proc.ireg[dec.rs1]) / sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? std::numeric_limits<sx>::min() : sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(proc.ireg[dec.rs1]) / sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_divu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(ux(proc.ireg[dec.rs1]) / ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? -1 : sx(ux(proc.ireg[dec.rs1]) / ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_rem:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? 0 : sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(proc.ireg[dec.rs1]) % sx(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) == std::numeric_limits<sx>::min() && sx(proc.ireg[dec.rs2]) == -1 ? 0 : sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(proc.ireg[dec.rs1]) % sx(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_remu:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(ux(proc.ireg[dec.rs1]) % ux(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) == 0 ? sx(proc.ireg[dec.rs1]) : sx(ux(proc.ireg[dec.rs1]) % ux(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_mulw:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) * u32(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = s32(u32(proc.ireg[dec.rs1]) * u32(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_divw:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) == std::numeric_limits<s32>::min() && s32(proc.ireg[dec.rs2]) == -1 ? std::numeric_limits<s32>::min() : s32(proc.ireg[dec.rs2]) == 0 ? -1 : s32(proc.ireg[dec.rs1]) / s32(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) == std::numeric_limits<s32>::min() && s32(proc.ireg[dec.rs2]) == -1 ? std::numeric_limits<s32>::min() : s32(proc.ireg[dec.rs2]) == 0 ? -1 : s32(proc.ireg[dec.rs1]) / s32(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_divuw:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs2]) == 0 ? -1 : s32(u32(proc.ireg[dec.rs1]) / u32(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs2]) == 0 ? -1 : s32(u32(proc.ireg[dec.rs1]) / u32(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_remw:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) == std::numeric_limits<s32>::min() && s32(proc.ireg[dec.rs2]) == -1 ? 0 : s32(proc.ireg[dec.rs2]) == 0 ? s32(proc.ireg[dec.rs1]) : s32(proc.ireg[dec.rs1]) % s32(proc.ireg[dec.rs2]);
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]) == std::numeric_limits<s32>::min() && s32(proc.ireg[dec.rs2]) == -1 ? 0 : s32(proc.ireg[dec.rs2]) == 0 ? s32(proc.ireg[dec.rs1]) : s32(proc.ireg[dec.rs1]) % s32(proc.ireg[dec.rs2]);
 			};
 			break;
 		case riscv_op_remuw:
 			if (rvm) {
-				if (dec.rd > 0) proc.ireg[dec.rd] = s32(proc.ireg[dec.rs2]) == 0 ? s32(proc.ireg[dec.rs1]) : s32(u32(proc.ireg[dec.rs1]) % u32(proc.ireg[dec.rs2]));
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs2]) == 0 ? s32(proc.ireg[dec.rs1]) : s32(u32(proc.ireg[dec.rs1]) % u32(proc.ireg[dec.rs2]));
 			};
 			break;
 		case riscv_op_lr_w:
@@ -1304,9 +1394,415 @@ riscv::addr_t exec_inst_rv64(T &dec, P &proc, riscv::addr_t pc_offset)
 				proc.freg[dec.rd].r.lu.val = u64(proc.ireg[dec.rs1]);
 			};
 			break;
+		case riscv_op_nop:
+			if (rvi) {
+				pc_offset = pc_offset;
+			};
+			break;
+		case riscv_op_mv:
+			if (rvi) {
+				proc.ireg[dec.rd] = proc.ireg[dec.rs1];
+			};
+			break;
+		case riscv_op_not:
+			if (rvi) {
+				proc.ireg[dec.rd] = ~ux(proc.ireg[dec.rs1]);
+			};
+			break;
+		case riscv_op_neg:
+			if (rvi) {
+				proc.ireg[dec.rd] = -ux(proc.ireg[dec.rs2]);
+			};
+			break;
+		case riscv_op_negw:
+			if (rvi) {
+				proc.ireg[dec.rd] = s32(-u32(proc.ireg[dec.rs2]));
+			};
+			break;
+		case riscv_op_sext_w:
+			if (rvi) {
+				proc.ireg[dec.rd] = s32(proc.ireg[dec.rs1]);
+			};
+			break;
+		case riscv_op_seqz:
+			if (rvi) {
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs1]) == 0;
+			};
+			break;
+		case riscv_op_snez:
+			if (rvi) {
+				proc.ireg[dec.rd] = ux(proc.ireg[dec.rs2]) != 0;
+			};
+			break;
+		case riscv_op_sltz:
+			if (rvi) {
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs1]) < 0;
+			};
+			break;
+		case riscv_op_sgtz:
+			if (rvi) {
+				proc.ireg[dec.rd] = sx(proc.ireg[dec.rs2]) > 0;
+			};
+			break;
+		case riscv_op_beqz:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) == 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bnez:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) != 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_blez:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs2]) <= 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bgez:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) >= 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bltz:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs1]) < 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_bgtz:
+			if (rvi) {
+				if (sx(proc.ireg[dec.rs2]) > 0) pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_j:
+			if (rvi) {
+				pc_offset = dec.imm;
+			};
+			break;
+		case riscv_op_ret:
+			if (rvi) {
+				pc_offset = proc.ireg[dec.rs1] + dec.imm - proc.pc;
+			};
+			break;
+		case riscv_op_jr:
+			if (rvi) {
+				pc_offset = proc.ireg[dec.rs1] - proc.pc;
+			};
+			break;
+		case riscv_op_li:
+			if (rvi) {
+				proc.ireg[dec.rd] = sx(dec.imm);
+			};
+			break;
 		default: return 0; /* illegal instruction */
 	}
 	return pc_offset;
 }
 
+/* Canonicalize Instruction RV32 */
+
+template <typename T>
+void canonicalize_inst_rv32(T &dec)
+{
+	using namespace riscv;
+	auto imm = dec.imm;
+	auto rd = dec.rd, rs1 = dec.rs1, rs2 = dec.rs2;
+
+	switch (dec.op) {
+		case riscv_op_lui:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_auipc:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_jal:
+			if ((rd == 0)) { dec.op = riscv_op_j; break; }
+			return;
+		case riscv_op_jalr:
+			if ((rd == 0) && (rs1 == 1)) { dec.op = riscv_op_ret; break; }
+			if ((rd == 0) && (imm == 0)) { dec.op = riscv_op_jr; break; }
+			return;
+		case riscv_op_beq:
+			if ((rs2 == 0)) { dec.op = riscv_op_beqz; break; }
+			return;
+		case riscv_op_bne:
+			if ((rs2 == 0)) { dec.op = riscv_op_bnez; break; }
+			return;
+		case riscv_op_blt:
+			if ((rs2 == 0)) { dec.op = riscv_op_bltz; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_bgtz; break; }
+			return;
+		case riscv_op_bge:
+			if ((rs1 == 0)) { dec.op = riscv_op_blez; break; }
+			if ((rs2 == 0)) { dec.op = riscv_op_bgez; break; }
+			return;
+		case riscv_op_addi:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((imm == 0)) { dec.op = riscv_op_mv; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_li; break; }
+			return;
+		case riscv_op_slti:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sltiu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((imm == 1)) { dec.op = riscv_op_seqz; break; }
+			return;
+		case riscv_op_xori:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((imm == -1)) { dec.op = riscv_op_not; break; }
+			return;
+		case riscv_op_ori:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_andi:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_slli_rv32i:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srli_rv32i:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srai_rv32i:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_add:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sub:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_neg; break; }
+			return;
+		case riscv_op_sll:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_slt:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((rs2 == 0)) { dec.op = riscv_op_sltz; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_sgtz; break; }
+			return;
+		case riscv_op_sltu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_snez; break; }
+			return;
+		case riscv_op_xor:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srl:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sra:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_or:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_and:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mul:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mulh:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mulhsu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mulhu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_div:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_divu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_rem:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_remu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		default: return;
+	}
+	dec.codec = riscv_inst_codec[dec.op];
+}
+
+/* Canonicalize Instruction RV64 */
+
+template <typename T>
+void canonicalize_inst_rv64(T &dec)
+{
+	using namespace riscv;
+	auto imm = dec.imm;
+	auto rd = dec.rd, rs1 = dec.rs1, rs2 = dec.rs2;
+
+	switch (dec.op) {
+		case riscv_op_lui:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_auipc:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_jal:
+			if ((rd == 0)) { dec.op = riscv_op_j; break; }
+			return;
+		case riscv_op_jalr:
+			if ((rd == 0) && (rs1 == 1)) { dec.op = riscv_op_ret; break; }
+			if ((rd == 0) && (imm == 0)) { dec.op = riscv_op_jr; break; }
+			return;
+		case riscv_op_beq:
+			if ((rs2 == 0)) { dec.op = riscv_op_beqz; break; }
+			return;
+		case riscv_op_bne:
+			if ((rs2 == 0)) { dec.op = riscv_op_bnez; break; }
+			return;
+		case riscv_op_blt:
+			if ((rs2 == 0)) { dec.op = riscv_op_bltz; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_bgtz; break; }
+			return;
+		case riscv_op_bge:
+			if ((rs1 == 0)) { dec.op = riscv_op_blez; break; }
+			if ((rs2 == 0)) { dec.op = riscv_op_bgez; break; }
+			return;
+		case riscv_op_addi:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((imm == 0)) { dec.op = riscv_op_mv; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_li; break; }
+			return;
+		case riscv_op_slti:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sltiu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((imm == 1)) { dec.op = riscv_op_seqz; break; }
+			return;
+		case riscv_op_xori:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((imm == -1)) { dec.op = riscv_op_not; break; }
+			return;
+		case riscv_op_ori:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_andi:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_add:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sub:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_neg; break; }
+			return;
+		case riscv_op_sll:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_slt:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((rs2 == 0)) { dec.op = riscv_op_sltz; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_sgtz; break; }
+			return;
+		case riscv_op_sltu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_snez; break; }
+			return;
+		case riscv_op_xor:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srl:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sra:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_or:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_and:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_slli_rv64i:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srli_rv64i:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srai_rv64i:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_addiw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((imm == 0)) { dec.op = riscv_op_sext_w; break; }
+			return;
+		case riscv_op_slliw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srliw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sraiw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_addw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_subw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			if ((rs1 == 0)) { dec.op = riscv_op_negw; break; }
+			return;
+		case riscv_op_sllw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_srlw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_sraw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mul:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mulh:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mulhsu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mulhu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_div:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_divu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_rem:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_remu:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_mulw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_divw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_divuw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_remw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		case riscv_op_remuw:
+			if (rd == 0) { dec.op = riscv_op_nop; break; }
+			return;
+		default: return;
+	}
+	dec.codec = riscv_inst_codec[dec.op];
+}
+
 #endif
@@ -143,6 +143,8 @@ namespace riscv {
 		UX           mibound;         /* Mbbid: Separate Instruction Bound Register */
 		UX           mdbase;          /* Mbbid: Separate Data Base Register */
 		UX           mdbound;         /* Mbbid: Separate Data Bound Register */
+		UX           pmpcfg[4];       /* Physical Memory Protection Configuration (RV64 uses 0 and 2) */
+		UX           pmpaddr[16];     /* Physical Memory Protection Address Registers */
 		UX           sptbr;           /* Supervisor Page Table Base Register */
 		UX           stvec;           /* Supervisor Trap Vector Base-Address Register */
 		UX           sscratch;        /* Supervisor Scratch Register */
@@ -159,7 +161,7 @@ namespace riscv {
 		u64          msinstret_delta; /* Machine Supervisor Number of Instructions Retired Delta */
 		u64          muinstret_delta; /* Machine User Number of Instructions Retired Delta */
 
-		processor_priv() : processor_type(), pdid(-1), mode(priv_mode_M) {}
+		processor_priv() : processor_type(), pdid(-1), mode(priv_mode_M), pmpcfg(), pmpaddr() {}
 	};
 
 	using processor_priv_rv32imafd = processor_priv<s32,u32,ireg_rv32,32,freg_fp64,32>;
@@ -0,0 +1,90 @@
+//
+//  riscv-mmio.h
+//
+
+#ifndef riscv_mmio_h
+#define riscv_mmio_h
+
+namespace riscv {
+
+	/*
+	 * mmio_device
+	 *
+	 * register window of a memory mapped device on the privileged MMU.
+	 * Loads and stores that do not hit RAM are routed to the device
+	 * whose window contains the physical address.
+	 */
+
+	template <typename UX>
+	struct mmio_device
+	{
+		UX mmio_base;              /* base physical address of the register window */
+		UX mmio_size;              /* register window size */
+
+		mmio_device(UX mmio_base, UX mmio_size) : mmio_base(mmio_base), mmio_size(mmio_size) {}
+		virtual ~mmio_device() {}
+
+		virtual u64 load(UX offset, size_t len) = 0;
+		virtual void store(UX offset, u64 val, size_t len) = 0;
+		virtual bool irq_pending() = 0;
+	};
+
+
+	/*
+	 * mmio_device_adapter
+	 *
+	 * attaches a device with mmio_load, mmio_store and irq_pending methods
+	 * and an mmio_base member (uart_16550, virtio_blk) to the bus
+	 */
+
+	template <typename UX, typename DEVICE>
+	struct mmio_device_adapter : mmio_device<UX>
+	{
+		DEVICE &dev;
+
+		mmio_device_adapter(DEVICE &dev, UX mmio_size) :
+			mmio_device<UX>(dev.mmio_base, mmio_size), dev(dev) {}
+
+		u64 load(UX offset, size_t len) { return dev.mmio_load(offset); }
+		void store(UX offset, u64 val, size_t len) { dev.mmio_store(offset, val); }
+		bool irq_pending() { return dev.irq_pending(); }
+	};
+
+
+	/*
+	 * mmio_bus
+	 *
+	 * devices attached to the privileged MMU, searched in order
+	 */
+
+	template <typename UX>
+	struct mmio_bus
+	{
+		std::vector<mmio_device<UX>*> devices;
+
+		void add(mmio_device<UX> *dev) { devices.push_back(dev); }
+
+		bool empty() { return devices.empty(); }
+
+		/* device whose window holds the access, or nullptr */
+		mmio_device<UX>* lookup(UX pa, size_t len)
+		{
+			for (auto dev : devices) {
+				if (pa >= dev->mmio_base && pa - dev->mmio_base + len <= dev->mmio_size) return dev;
+			}
+			return nullptr;
+		}
+
+		/* level of the shared external interrupt line */
+		bool irq_pending()
+		{
+			for (auto dev : devices) {
+				if (dev->irq_pending()) return true;
+			}
+			return false;
+		}
+	};
+
+}
+
+#endif
@@ -22,7 +22,9 @@ namespace riscv {
 		cache_type     l1_dcache;   /* L1 Data Cache */
 		cache_type     l1_icache;   /* L1 Instruction Cache */
 		pma_type       pma;         /* PMA table */
+		pmp_page_cache<64> l1_pmp;  /* PMP page cache for untranslated accesses */
 		memory_type    mem;         /* memory device */
+		mmio_bus<UX>   mmio;        /* memory mapped devices */
 
 		/* MMU methods */
 
@@ -30,26 +32,76 @@ namespace riscv {
 		{
 			/* TODO: translate, check tags, PMA and cache */
 
-			/* will call riscv::inst_fetch(uva, pc_offset) with the translated address */
+			/*
+			 * will call riscv::inst_fetch(uva, pc_offset) with the translated address
+			 * once fetch is translated, checking pmp_cfg_X with pmp_check. Until then
+			 * PMP execute permission is not enforced.
+			 */
 			pc_offset = 0;
 
 			return 0; /* illegel instruction */
 		}
 
+		/*
+		 * translate and PMP check an access, returns the host address or -1.
+		 * pa is the permitted physical address, or -1 if the access faulted.
+		 */
+		template <typename P> intptr_t access_uva(P &proc, UX va, size_t len,
+			pmp_t perm, bool translated, addr_t &pa)
+		{
+			typename tlb_type::tlb_entry_t *tlb_ent = nullptr;
+			pa = addr_t(-1);
+			if ((va & ~page_mask) + len > page_size) return -1; /* TODO: split page crossing accesses */
+			addr_t tpa = translated ? get_physical_address(proc, va, false, tlb_ent) : addr_t(va);
+			if (tpa == addr_t(-1)) return -1;
+			if (!(pmp_check(proc, tpa, len, tlb_ent) & perm)) return -1;
+			pa = tpa;
+			return mem.mpa_to_uva(pa);
+		}
+
+		template <typename P> intptr_t access_uva(P &proc, UX va, size_t len,
+			pmp_t perm, bool translated)
+		{
+			addr_t pa;
+			return access_uva(proc, va, len, perm, translated, pa);
+		}
+
 		// T is one of u64, u32, u16, u8
 		template <typename P, typename T> bool load(P &proc, UX va, T &val, bool aligned, bool translated)
 		{
-			/* TODO: translate, check tags, PMA and cache */
+			/* TODO: check tags, PMA and cache */
 
-			return false;
+			addr_t pa;
+			intptr_t uva = access_uva(proc, va, sizeof(T), pmp_cfg_R, translated, pa);
+			if (uva != -1) {
+				val = *(T*)uva;
+				return true;
+			}
+
+			/* accesses outside RAM go to memory mapped devices */
+			mmio_device<UX> *dev = pa != addr_t(-1) ? mmio.lookup(UX(pa), sizeof(T)) : nullptr;
+			if (!dev) return false;
+			val = T(dev->load(UX(pa) - dev->mmio_base, sizeof(T)));
+			return true;
 		}
 
 		// T is one of u64, u32, u16, u8
 		template <typename P, typename T> bool store(P &proc, UX va, T val, bool aligned, bool translated)
 		{
-			/* TODO: translate, check tags, PMA and cache */
+			/* TODO: check tags, PMA and cache */
 
-			return false;
+			addr_t pa;
+			intptr_t uva = access_uva(proc, va, sizeof(T), pmp_cfg_W, translated, pa);
+			if (uva != -1) {
+				*(T*)uva = val;
+				return true;
+			}
+
+			/* accesses outside RAM go to memory mapped devices */
+			mmio_device<UX> *dev = pa != addr_t(-1) ? mmio.lookup(UX(pa), sizeof(T)) : nullptr;
+			if (!dev) return false;
+			dev->store(UX(pa) - dev->mmio_base, u64(val), sizeof(T));
+			return true;
 		}
 
 		template <typename P> addr_t get_physical_address(P &proc, UX va,
@@ -57,10 +109,10 @@ namespace riscv {
 		{
 			tlb_ent = nullptr;
 			addr_t pa = -1; /* fault */
-			if (proc.mode == priv_mode_M && proc.mstatus.r.mprv == 0) {
+			if (proc.mode == priv_mode_M && proc.mstatus.status.mprv == 0) {
 				pa = va;
 			} else {
-				switch (proc.mstatus.vm) {
+				switch (proc.mstatus.status.vm) {
 					case riscv_vm_mbare:
 						pa = va;
 						break;
@@ -88,26 +140,40 @@ namespace riscv {
 			return pa;
 		}
 
-		template <typename P, typename PTM> addr_t translate_addr(P &proc, UX va,
+		/*
+		 * PMP permissions for an access, using the TLB entry when the page is not
+		 * split, otherwise the physical page cache (bare and M mode accesses)
+		 */
+		template <typename P> pmp_t pmp_check(P &proc, addr_t pa, size_t len,
+			typename tlb_type::tlb_entry_t* tlb_ent)
+		{
+			if (tlb_ent && (tlb_ent->pmp & pmp_page_valid) && !(tlb_ent->pmp & pmp_page_partial)) {
+				return tlb_ent->pmp & pmp_perm_mask;
+			}
+			return l1_pmp.perm(proc.pmpcfg, proc.pmpaddr, proc.mode, pa, len);
+		}
+
+		template <typename PTM, typename P> addr_t translate_addr(P &proc, UX va,
 			tlb_type &tlb, typename tlb_type::tlb_entry_t* &tlb_ent)
 		{
-			tlb_ent = tlb.lookup(proc.pdid, proc.sbptr >> tlb_type::ppn_bits, va);
+			tlb_ent = tlb.lookup(proc.pdid, proc.sptbr >> tlb_type::ppn_bits, va);
 			if (tlb_ent) {
 				return (tlb_ent->ppn << page_shift) | (va & ~page_mask);
 			} else {
-				return translate_addr_tlb_miss(proc, va, tlb, tlb_ent);
+				return translate_addr_tlb_miss<PTM>(proc, va, tlb, tlb_ent);
 			}
 		}
 
-		template <typename P, typename PTM> addr_t translate_addr_tlb_miss(P &proc, UX va,
+		template <typename PTM, typename P> addr_t translate_addr_tlb_miss(P &proc, UX va,
 			tlb_type &tlb, typename tlb_type::tlb_entry_t* &tlb_ent)
 		{
 			typedef typename PTM::pte_type pte_type;
 
-			UX ppn = proc.sptbr & ((1ULL<<PTM::ppn_bits)-1);
-			UX vpn, pte_mpa, pte_uva;
+			UX ppn = proc.sptbr & ((1ULL<<tlb_type::ppn_bits)-1);
+			UX vpn = 0, pte_mpa;
+			intptr_t pte_uva;
 			int shift, level;
-			pte_type pte;
+			pte_type pte = pte_type();
 
 			/* walk the page table */
 			for (level = PTM::levels - 1; level >= 0; level--) {
@@ -115,7 +181,7 @@ namespace riscv {
 				/* calculate the shift for this page table level */
 				shift = PTM::bits * level + page_shift;
 				vpn = (va >> shift) & ((1ULL<<PTM::bits)-1);
-				pte_mpa = ppn + vpn * sizeof(pte_type);
+				pte_mpa = (ppn << page_shift) + vpn * sizeof(pte_type);
 
 				/* map the ppn into the host address space */
 				pte_uva = mem.mpa_to_uva(pte_mpa);
@@ -140,9 +206,16 @@ namespace riscv {
 					 * page_size interval, even if the PTE is a megapage or gigapage. This
 					 * can be solved by adding a secondary TLB with larger entries.
 					 */
-					tlb_ent = tlb.insert(proc.pdid, proc.sbptr >> tlb_type::ppn_bits,
+					tlb_ent = tlb.insert(proc.pdid, proc.sptbr >> tlb_type::ppn_bits,
 						va, pte.val.flags, pte.val.ppn);
 
+					/*
+					 * Cache the PMP permissions for the page. Translated accesses
+					 * are from S or U mode which PMP treats identically, so the
+					 * result stays valid until the next pmpcfg or pmpaddr write.
+					 */
+					tlb_ent->pmp = pmp_page_perm(proc.pmpcfg, proc.pmpaddr, priv_mode_S, pa);
+
 					/* return the translation */
 					return pa;
 				}
@@ -151,12 +224,13 @@ namespace riscv {
 				ppn = pte.val.ppn;
 
 				/* clearing the pte holder so translation fault messages contain zeros */
-				pte.wu.val = 0;
+				pte = pte_type();
 			}
 
 		out:
-			debug("walk_page_table va=%llx sptbr=%llx, level=%d ppn=%llx vpn=%llx pte=%llx: translation fault",
-				(addr_t)va, (addr_t)proc.sptbr, level, (addr_t)ppn, (addr_t)vpn, (addr_t)pte.wu.val);
+			debug("walk_page_table va=%llx sptbr=%llx, level=%d ppn=%llx vpn=%llx pte.ppn=%llx pte.flags=%x: translation fault",
+				(addr_t)va, (addr_t)proc.sptbr, level, (addr_t)ppn, (addr_t)vpn,
+				(addr_t)pte.val.ppn, (u32)pte.val.flags);
 
 			return -1; /* invalid */
 		}
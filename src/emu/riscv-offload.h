@@ -0,0 +1,187 @@
+//
+//  riscv-offload.h
+//
+
+#ifndef riscv_offload_h
+#define riscv_offload_h
+
+namespace riscv {
+
+	/*
+	 * mpmc_ring
+	 *
+	 * bounded lock-free multiple producer, multiple consumer queue
+	 *
+	 * Each cell carries a sequence number that tells producers and
+	 * consumers whether the cell is free or full for their lap of the
+	 * ring, so push and pop only contend on a single compare-exchange.
+	 */
+
+	template <typename T, const size_t ring_size = 256>
+	struct mpmc_ring
+	{
+		static_assert(ispow2(ring_size), "ring_size must be a power of 2");
+
+		struct cell
+		{
+			std::atomic<size_t> seq;
+			T data;
+		};
+
+		cell cells[ring_size];
+		std::atomic<size_t> head;               /* consumer position */
+		char pad[64];                           /* keep head and tail on separate cache lines */
+		std::atomic<size_t> tail;               /* producer position */
+
+		mpmc_ring() : head(0), pad(), tail(0)
+		{
+			for (size_t i = 0; i < ring_size; i++) {
+				cells[i].seq.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		bool empty()
+		{
+			return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+		}
+
+		/* returns false if the ring is full */
+		bool push(const T &v)
+		{
+			size_t pos = tail.load(std::memory_order_relaxed);
+			for (;;) {
+				cell &c = cells[pos & (ring_size - 1)];
+				size_t seq = c.seq.load(std::memory_order_acquire);
+				intptr_t diff = intptr_t(seq) - intptr_t(pos);
+				if (diff == 0) {
+					if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						c.data = v;
+						c.seq.store(pos + 1, std::memory_order_release);
+						return true;
+					}
+				} else if (diff < 0) {
+					return false;
+				} else {
+					pos = tail.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/* returns false if the ring is empty */
+		bool pop(T &v)
+		{
+			size_t pos = head.load(std::memory_order_relaxed);
+			for (;;) {
+				cell &c = cells[pos & (ring_size - 1)];
+				size_t seq = c.seq.load(std::memory_order_acquire);
+				intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+				if (diff == 0) {
+					if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						v = c.data;
+						c.seq.store(pos + ring_size, std::memory_order_release);
+						return true;
+					}
+				} else if (diff < 0) {
+					return false;
+				} else {
+					pos = head.load(std::memory_order_relaxed);
+				}
+			}
+		}
+	};
+
+
+	/*
+	 * offload_pool
+	 *
+	 * pool of host threads that run potentially blocking host calls
+	 *
+	 * REQ must provide a void run() method. Requests are handed to the
+	 * workers through a locked queue and completed requests come back
+	 * through a lock-free ring that the harts poll at block boundaries.
+	 * Request storage is owned by the submitter and must stay valid
+	 * until the request is returned by complete().
+	 *
+	 * A parked hart does no work until its result comes back. With the
+	 * single hart the emulator runs today the pool only adds a handoff
+	 * to a worker and back for every call, so it is off by default.
+	 */
+
+	template <typename REQ, const size_t completion_size = 256>
+	struct offload_pool
+	{
+		std::vector<std::thread> workers;
+		std::deque<REQ*> submitted;
+		std::mutex lock;
+		std::condition_variable wakeup;
+		bool running;
+
+		mpmc_ring<REQ*,completion_size> completed;
+		std::mutex done_lock;
+		std::condition_variable done;
+
+		offload_pool(size_t num_threads) : running(true)
+		{
+			for (size_t i = 0; i < num_threads; i++) {
+				workers.push_back(std::thread(&offload_pool::worker_thread, this));
+			}
+		}
+
+		~offload_pool()
+		{
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				running = false;
+			}
+			wakeup.notify_all();
+			for (auto &worker : workers) worker.join();
+		}
+
+		void submit(REQ *req)
+		{
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				submitted.push_back(req);
+			}
+			wakeup.notify_one();
+		}
+
+		/* returns the next completed request or nullptr */
+		REQ* complete()
+		{
+			REQ *req;
+			return completed.pop(req) ? req : nullptr;
+		}
+
+		/* wait up to timeout_us for a completion, used by harts with nothing to run */
+		void wait(int timeout_us)
+		{
+			std::unique_lock<std::mutex> guard(done_lock);
+			done.wait_for(guard, std::chrono::microseconds(timeout_us),
+				[&] { return !completed.empty(); });
+		}
+
+	private:
+		void worker_thread()
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			for (;;) {
+				wakeup.wait(guard, [&] { return !running || !submitted.empty(); });
+				if (submitted.empty()) break;
+				REQ *req = submitted.front();
+				submitted.pop_front();
+				guard.unlock();
+				req->run();
+				while (!completed.push(req)) std::this_thread::yield();
+				{
+					std::lock_guard<std::mutex> done_guard(done_lock);
+				}
+				done.notify_all();
+				guard.lock();
+			}
+		}
+	};
+
+}
+
+#endif
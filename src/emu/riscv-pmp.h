@@ -0,0 +1,187 @@
+//
+//  riscv-pmp.h
+//
+
+#ifndef riscv_pmp_h
+#define riscv_pmp_h
+
+namespace riscv {
+
+	typedef u8 pmp_t;                /* physical memory protection permission type */
+
+	/* pmpcfg entry fields */
+
+	enum {
+		pmp_cfg_R        = 1<<0,     /* Read */
+		pmp_cfg_W        = 1<<1,     /* Write */
+		pmp_cfg_X        = 1<<2,     /* Execute */
+		pmp_cfg_A_shift  = 3,        /* Address matching mode */
+		pmp_cfg_A_mask   = 3<<3,
+		pmp_cfg_L        = 1<<7,     /* Locked (also enforced in M mode) */
+		pmp_entries      = 16,
+	};
+
+	enum pmp_match {
+		pmp_match_off    = 0,        /* Null region (disabled) */
+		pmp_match_tor    = 1,        /* Top of range */
+		pmp_match_na4    = 2,        /* Naturally aligned four-byte region */
+		pmp_match_napot  = 3,        /* Naturally aligned power-of-two region */
+	};
+
+	/* cached page permissions (pmp_cfg_R | pmp_cfg_W | pmp_cfg_X) and cache state */
+
+	enum {
+		pmp_perm_mask    = pmp_cfg_R | pmp_cfg_W | pmp_cfg_X,
+		pmp_page_partial = 1<<6,     /* a region boundary splits the page, check each access */
+		pmp_page_valid   = 1<<7,     /* permissions have been computed for this page */
+	};
+
+	/* unpack the configuration byte for entry i from the pmpcfg CSRs */
+	template <typename UX>
+	inline u8 pmp_cfg(const UX *pmpcfg, size_t i)
+	{
+		/* RV32 packs 4 entries per CSR, RV64 packs 8 in the even numbered CSRs */
+		const size_t per_csr = sizeof(UX);
+		const size_t csr = (i / per_csr) * (per_csr >> 2);
+		return u8(pmpcfg[csr] >> ((i % per_csr) << 3));
+	}
+
+	/*
+	 * compute the physical address range [lo, hi) for entry i
+	 *
+	 * pmpaddr holds bits [XLEN+1:2] of the address, returns false for OFF entries
+	 */
+	template <typename UX>
+	inline bool pmp_range(const UX *pmpcfg, const UX *pmpaddr, size_t i, u64 &lo, u64 &hi)
+	{
+		u8 cfg = pmp_cfg(pmpcfg, i);
+		u64 addr = u64(pmpaddr[i]);
+		switch ((cfg & pmp_cfg_A_mask) >> pmp_cfg_A_shift) {
+			case pmp_match_tor:
+				lo = i == 0 ? 0 : u64(pmpaddr[i - 1]) << 2;
+				hi = addr << 2;
+				return lo < hi;
+			case pmp_match_na4:
+				lo = addr << 2;
+				hi = lo + 4;
+				return true;
+			case pmp_match_napot:
+			{
+				/* trailing ones select the region size: 2^(ones + 3) bytes */
+				u64 ones = ctz(~addr);
+				u64 size = ones >= 61 ? 0 : 8ULL << ones;
+				lo = (addr & ~((1ULL << ones) - 1)) << 2;
+				hi = size ? lo + size : ~0ULL;
+				return true;
+			}
+			default:
+				return false;
+		}
+	}
+
+	/*
+	 * match a physical page against the PMP entries for the given mode
+	 *
+	 * The lowest numbered entry that overlaps the page determines the
+	 * permissions. If that entry does not cover the whole page the
+	 * result is marked partial and must not be cached. The result is
+	 * meant to be computed once at TLB refill and cached in the entry.
+	 */
+	template <typename UX>
+	inline pmp_t pmp_page_perm(const UX *pmpcfg, const UX *pmpaddr, int mode, u64 pa)
+	{
+		u64 page_lo = pa & ~u64(page_size - 1), page_hi = page_lo + page_size;
+		bool any_active = false;
+		for (size_t i = 0; i < pmp_entries; i++) {
+			u64 lo, hi;
+			if (!pmp_range(pmpcfg, pmpaddr, i, lo, hi)) continue;
+			any_active = true;
+			if (hi <= page_lo || lo >= page_hi) continue;
+			u8 cfg = pmp_cfg(pmpcfg, i);
+			pmp_t perm = (mode == priv_mode_M && !(cfg & pmp_cfg_L)) ?
+				pmp_perm_mask : (cfg & pmp_perm_mask);
+			bool covers = lo <= page_lo && hi >= page_hi;
+			return pmp_page_valid | perm | (covers ? 0 : pmp_page_partial);
+		}
+		/* no match: M mode has full access, other modes fail if any entry is active */
+		return pmp_page_valid | ((mode == priv_mode_M || !any_active) ? pmp_perm_mask : 0);
+	}
+
+	/* match a single access of len bytes (used for partial pages) */
+	template <typename UX>
+	inline pmp_t pmp_access_perm(const UX *pmpcfg, const UX *pmpaddr, int mode, u64 pa, size_t len)
+	{
+		bool any_active = false;
+		for (size_t i = 0; i < pmp_entries; i++) {
+			u64 lo, hi;
+			if (!pmp_range(pmpcfg, pmpaddr, i, lo, hi)) continue;
+			any_active = true;
+			if (hi <= pa || lo >= pa + len) continue;
+			/* an access that only partially matches the entry fails */
+			if (lo > pa || hi < pa + len) return 0;
+			u8 cfg = pmp_cfg(pmpcfg, i);
+			return (mode == priv_mode_M && !(cfg & pmp_cfg_L)) ?
+				pmp_perm_mask : (cfg & pmp_perm_mask);
+		}
+		return (mode == priv_mode_M || !any_active) ? pmp_perm_mask : 0;
+	}
+
+	/*
+	 * pmp_page_cache
+	 *
+	 * direct mapped page permission cache for untranslated (bare and M mode) accesses
+	 *
+	 * cache[M:PPN] = PMP
+	 *
+	 * Translated accesses cache their permissions in the TLB entry. The owner
+	 * must flush this cache on any pmpcfg or pmpaddr write.
+	 */
+
+	template <const size_t cache_size>
+	struct pmp_page_cache
+	{
+		static_assert(ispow2(cache_size), "cache_size must be a power of 2");
+
+		enum : u64 {
+			size = cache_size,
+			mask = cache_size - 1,
+			invalid_tag = ~0ULL
+		};
+
+		struct pmp_page_ent
+		{
+			u64   tag;                   /* PPN << 1 | (mode == M) */
+			pmp_t pmp;                   /* cached pmp_page_perm result */
+		};
+
+		pmp_page_ent ent[size];
+
+		pmp_page_cache() { flush(); }
+
+		void flush()
+		{
+			for (size_t i = 0; i < size; i++) {
+				ent[i].tag = invalid_tag;
+				ent[i].pmp = 0;
+			}
+		}
+
+		/* permissions for an access, computing and caching the page result on a miss */
+		template <typename UX>
+		pmp_t perm(const UX *pmpcfg, const UX *pmpaddr, int mode, u64 pa, size_t len)
+		{
+			u64 ppn = pa >> page_shift;
+			u64 tag = (ppn << 1) | (mode == priv_mode_M);
+			pmp_page_ent &e = ent[ppn & mask];
+			if (e.tag != tag) {
+				e.tag = tag;
+				e.pmp = pmp_page_perm(pmpcfg, pmpaddr, mode, pa);
+			}
+			return (e.pmp & pmp_page_partial) ?
+				pmp_access_perm(pmpcfg, pmpaddr, mode, pa, len) : (e.pmp & pmp_perm_mask);
+		}
+	};
+
+}
+
+#endif
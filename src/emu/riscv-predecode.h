@@ -0,0 +1,248 @@
+//
+//  riscv-predecode.h
+//
+
+#ifndef riscv_predecode_h
+#define riscv_predecode_h
+
+namespace riscv {
+
+	/*
+	 * pre-decoded segment image, as mapped and as stored in the cache
+	 *
+	 *   header  : magic "RVPD", version, slot count
+	 *   dec     : decode_compact[slots]
+	 *   len     : u8[slots]
+	 */
+
+	struct predecode_header
+	{
+		char magic[4];
+		u32  version;
+		u64  slots;
+	};
+
+	/*
+	 * predecode_segment
+	 *
+	 * compact decode and length of the instruction starting at each
+	 * 2-byte slot of [begin, end). Slots that do not decode, or whose
+	 * instruction would cross end, have length 0. A zero parcel is
+	 * illegal, it marks routines patched for HLE.
+	 */
+
+	struct predecode_segment
+	{
+		addr_t begin;
+		addr_t end;
+		int prot;                                /* host protection when decoded */
+		void *map;                               /* image owned by inst_predecode */
+		size_t map_size;
+		decode_compact *dec;
+		u8 *len;
+
+		size_t slots() const { return size_t(end - begin) >> 1; }
+
+		static size_t image_size(size_t slots)
+		{
+			return sizeof(predecode_header) + slots * (sizeof(decode_compact) + 1);
+		}
+
+		/* point dec and len into the image at map */
+		void attach(void *addr, size_t size)
+		{
+			map = addr;
+			map_size = size;
+			dec = (decode_compact*)((u8*)map + sizeof(predecode_header));
+			len = (u8*)(dec + slots());
+		}
+
+		/* decode slots [first, last), decode(inst, dec) returns false for illegal instructions */
+		template <typename F>
+		void decode_slots(size_t first, size_t last, F decode)
+		{
+			for (size_t i = first; i < last; i++) {
+				addr_t addr = begin + (i << 1), pc_offset;
+				inst_t inst;
+				if (end - addr >= 8) {
+					inst = inst_fetch(addr, pc_offset);
+				} else {
+					/* don't read past the end of the segment */
+					u8 buf[8] = { 0 };
+					memcpy(buf, (const void*)addr, end - addr);
+					inst = inst_fetch(addr_t(buf), pc_offset);
+				}
+				if (inst == 0 || addr + pc_offset > end || !decode(inst, dec[i])) {
+					dec[i] = decode_compact();
+					pc_offset = 0;
+				}
+				len[i] = u8(pc_offset);
+			}
+		}
+	};
+
+
+	/*
+	 * inst_predecode
+	 *
+	 * whole image pre-decode of static executable segments
+	 *
+	 * Segments are decoded once at load time, split across host threads,
+	 * so the stepper can execute them without fetching or decoding.
+	 * Instructions that are not pre-decoded are fetched and decoded
+	 * lazily. clear() falls back to lazy decode for the whole image,
+	 * generation records the guest mapping state that was last checked.
+	 *
+	 * Decoded images can be saved to and mapped from a content addressed
+	 * cache file, the caller names the file after a hash of the segment
+	 * bytes and everything else the decode depends on, including the
+	 * riscv_meta_digest of the generated decoder and opcode tables.
+	 * version only tracks the file layout. Mapping a file marks it as
+	 * recently used and evict() trims the cache directory.
+	 */
+
+	struct inst_predecode
+	{
+		enum { version = 1 };
+
+		std::vector<predecode_segment> segs;
+		u64 generation;
+
+		inst_predecode() : generation(0) {}
+		inst_predecode(const inst_predecode&) = delete;
+		inst_predecode& operator=(const inst_predecode&) = delete;
+		~inst_predecode() { clear(); }
+
+		bool empty() { return segs.empty(); }
+
+		void clear()
+		{
+			for (auto &seg : segs) munmap(seg.map, seg.map_size);
+			segs.clear();
+		}
+
+		static predecode_segment segment(addr_t begin, addr_t end, int prot)
+		{
+			predecode_segment seg;
+			seg.begin = round_up(begin, addr_t(2));
+			seg.end = std::max(seg.begin, end & ~addr_t(1));
+			seg.prot = prot;
+			return seg;
+		}
+
+		/* pre-decode [begin, end) using up to num_threads threads */
+		template <typename F>
+		void add(addr_t begin, addr_t end, int prot, size_t num_threads, F decode)
+		{
+			const size_t min_slots = 65536;
+			predecode_segment seg = segment(begin, end, prot);
+			size_t slots = seg.slots(), size = predecode_segment::image_size(slots);
+			void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+			if (addr == MAP_FAILED) {
+				panic("predecode: error: mmap: %s", strerror(errno));
+			}
+			predecode_header hdr = { { 'R', 'V', 'P', 'D' }, version, slots };
+			memcpy(addr, &hdr, sizeof(hdr));
+			seg.attach(addr, size);
+			size_t n = std::max(size_t(1), std::min(num_threads, slots / min_slots));
+			std::vector<std::thread> threads;
+			for (size_t t = 1; t < n; t++) {
+				threads.push_back(std::thread([&seg, &decode, slots, n, t] {
+					seg.decode_slots(slots * t / n, slots * (t + 1) / n, decode);
+				}));
+			}
+			seg.decode_slots(0, slots / n, decode);
+			for (auto &thread : threads) thread.join();
+			segs.push_back(seg);
+		}
+
+		/* map a cached image of [begin, end), returns false if there is no valid image */
+		bool load(const char *filename, addr_t begin, addr_t end, int prot)
+		{
+			predecode_segment seg = segment(begin, end, prot);
+			size_t size = predecode_segment::image_size(seg.slots());
+			int fd = ::open(filename, O_RDONLY);
+			if (fd < 0) return false;
+			struct stat stat_buf;
+			void *addr = MAP_FAILED;
+			if (fstat(fd, &stat_buf) == 0 && size_t(stat_buf.st_size) == size) {
+				addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+				futimens(fd, nullptr);
+			}
+			::close(fd);
+			if (addr == MAP_FAILED) return false;
+			predecode_header *hdr = (predecode_header*)addr;
+			if (memcmp(hdr->magic, "RVPD", 4) != 0 || hdr->version != version || hdr->slots != seg.slots()) {
+				munmap(addr, size);
+				return false;
+			}
+			seg.attach(addr, size);
+			segs.push_back(seg);
+			return true;
+		}
+
+		/* write the image of seg to filename, replacing it atomically */
+		static bool save(const char *filename, const predecode_segment &seg)
+		{
+			std::string tmp = format_string("%s.%d", filename, getpid());
+			int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+			if (fd < 0) return false;
+			bool ok = true;
+			for (size_t off = 0; ok && off < seg.map_size; ) {
+				ssize_t ret = ::write(fd, (const char*)seg.map + off, seg.map_size - off);
+				if (ret < 0 && errno == EINTR) continue;
+				ok = ret > 0;
+				if (ok) off += ret;
+			}
+			ok = (::close(fd) == 0) && ok;
+			ok = ok && ::rename(tmp.c_str(), filename) == 0;
+			if (!ok) ::unlink(tmp.c_str());
+			return ok;
+		}
+
+		static const char* cache_suffix() { return ".rvpd"; }
+
+		/* remove the least recently used cache files until dir holds at most max_bytes */
+		static void evict(const char *dir, size_t max_bytes)
+		{
+			struct cache_file { time_t mtime; size_t size; std::string path; };
+			std::vector<cache_file> files;
+			size_t total = 0, suffix_len = strlen(cache_suffix());
+			DIR *d = opendir(dir);
+			if (!d) return;
+			while (struct dirent *ent = readdir(d)) {
+				size_t len = strlen(ent->d_name);
+				if (len <= suffix_len || strcmp(ent->d_name + len - suffix_len, cache_suffix()) != 0) continue;
+				std::string path = std::string(dir) + "/" + ent->d_name;
+				struct stat stat_buf;
+				if (stat(path.c_str(), &stat_buf) != 0) continue;
+				files.push_back(cache_file{ stat_buf.st_mtime, size_t(stat_buf.st_size), path });
+				total += size_t(stat_buf.st_size);
+			}
+			closedir(d);
+			std::sort(files.begin(), files.end(), [] (const cache_file &a, const cache_file &b) {
+				return a.mtime < b.mtime;
+			});
+			for (auto &f : files) {
+				if (total <= max_bytes) break;
+				if (::unlink(f.path.c_str()) == 0) total -= f.size;
+			}
+		}
+
+		/* returns the instruction length at pc or 0 if pc is not pre-decoded */
+		addr_t lookup(addr_t pc, decode_compact &dec)
+		{
+			for (auto &seg : segs) {
+				addr_t offset = pc - seg.begin;
+				if (offset < seg.end - seg.begin && (offset & 1) == 0) {
+					dec = seg.dec[offset >> 1];
+					return seg.len[offset >> 1];
+				}
+			}
+			return 0;
+		}
+	};
+
+}
+
+#endif
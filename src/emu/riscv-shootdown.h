@@ -0,0 +1,232 @@
+//
+//  riscv-shootdown.h
+//
+
+#ifndef riscv_shootdown_h
+#define riscv_shootdown_h
+
+namespace riscv {
+
+	/* shootdown request flags */
+
+	enum shootdown_flag : u32 {
+		shootdown_flag_none      = 0,
+		shootdown_flag_range     = 1U<<0, /* queue contains ASID tagged ranges */
+		shootdown_flag_flush_all = 1U<<1, /* flush all TLB entries for this hart */
+		shootdown_flag_fence_i   = 1U<<2, /* invalidate instruction decode and translation caches */
+	};
+
+
+	/*
+	 * shootdown_range
+	 *
+	 * address space tagged virtual address range queued for invalidation
+	 *
+	 * [start, end) are page aligned, start == 0 && end == 0 flushes the whole ASID
+	 */
+
+	template <typename UX>
+	struct shootdown_range
+	{
+		UX asid;                    /* Address Space Identifier */
+		UX start;                   /* Page aligned start address */
+		UX end;                     /* Page aligned end address (exclusive) */
+
+		shootdown_range() : asid(0), start(0), end(0) {}
+		shootdown_range(UX asid, UX start, UX end) : asid(asid), start(start), end(end) {}
+
+		bool whole_asid() const { return start == 0 && end == 0; }
+		size_t pages() const { return size_t((end - start) >> page_shift); }
+	};
+
+
+	/*
+	 * shootdown_queue
+	 *
+	 * per hart invalidation queue
+	 *
+	 * Remote harts post ASID tagged ranges and the target hart drains
+	 * the queue at its next block boundary. Overlapping or adjacent
+	 * ranges for the same ASID are coalesced on insert. A range larger
+	 * than max_pages is promoted to a whole ASID flush and an overflowing
+	 * queue is promoted to a full flush, so the drain cost is bounded.
+	 */
+
+	template <typename UX, const size_t queue_size = 16, const size_t max_pages = 64>
+	struct shootdown_queue
+	{
+		typedef shootdown_range<UX> range_type;
+
+		std::mutex lock;            /* protects ranges and count */
+		std::atomic<u32> pending;   /* shootdown_flag bits, polled without the lock */
+		range_type ranges[queue_size];
+		size_t count;
+
+		shootdown_queue() : pending(shootdown_flag_none), count(0) {}
+
+		void post_flush_all()
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			count = 0;
+			pending.fetch_or(shootdown_flag_flush_all, std::memory_order_release);
+		}
+
+		void post_fence_i()
+		{
+			pending.fetch_or(shootdown_flag_fence_i, std::memory_order_release);
+		}
+
+		void post_asid(UX asid)
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			if (pending.load(std::memory_order_relaxed) & shootdown_flag_flush_all) return;
+			for (size_t i = 0; i < count; i++) {
+				if (ranges[i].asid != asid) continue;
+				ranges[i] = range_type(asid, 0, 0);
+				/* a whole ASID flush subsumes all other ranges for the ASID */
+				for (size_t j = count - 1; j > i; j--) {
+					if (ranges[j].asid == asid) ranges[j] = ranges[--count];
+				}
+				return;
+			}
+			append(range_type(asid, 0, 0));
+		}
+
+		void post_range(UX asid, UX start, UX size)
+		{
+			UX range_start = start & page_mask;
+			UX range_end = UX(round_up(start + size, page_size));
+			if (size == 0) return;
+			if (range_end <= range_start || ((range_end - range_start) >> page_shift) > max_pages) {
+				post_asid(asid);
+				return;
+			}
+			std::lock_guard<std::mutex> guard(lock);
+			if (pending.load(std::memory_order_relaxed) & shootdown_flag_flush_all) return;
+			for (size_t i = 0; i < count; i++) {
+				range_type &r = ranges[i];
+				if (r.asid != asid) continue;
+				if (r.whole_asid()) return;
+				if (range_start > r.end || range_end < r.start) continue;
+				/* coalesce overlapping or adjacent ranges */
+				r.start = std::min(r.start, range_start);
+				r.end = std::max(r.end, range_end);
+				if (r.pages() > max_pages) r = range_type(asid, 0, 0);
+				return;
+			}
+			append(range_type(asid, range_start, range_end));
+		}
+
+		/*
+		 * drain the queue into the given TLBs and return the flags that
+		 * were pending. The fast path is a single relaxed load.
+		 */
+		template <typename TLB>
+		u32 drain(UX pdid, TLB &itlb, TLB &dtlb)
+		{
+			if (pending.load(std::memory_order_relaxed) == shootdown_flag_none) {
+				return shootdown_flag_none;
+			}
+
+			range_type local[queue_size];
+			size_t local_count;
+			u32 flags;
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				flags = pending.exchange(shootdown_flag_none, std::memory_order_acquire);
+				local_count = count;
+				std::copy(ranges, ranges + count, local);
+				count = 0;
+			}
+
+			if (flags & shootdown_flag_flush_all) {
+				itlb.flush(pdid);
+				dtlb.flush(pdid);
+			} else if (flags & shootdown_flag_range) {
+				for (size_t i = 0; i < local_count; i++) {
+					range_type &r = local[i];
+					if (r.whole_asid()) {
+						itlb.flush(pdid, r.asid);
+						dtlb.flush(pdid, r.asid);
+						continue;
+					}
+					for (UX va = r.start; va != r.end; va += page_size) {
+						itlb.flush(pdid, r.asid, va);
+						dtlb.flush(pdid, r.asid, va);
+					}
+				}
+			}
+			return flags;
+		}
+
+	private:
+		/* caller holds the lock */
+		void append(range_type r)
+		{
+			if (count == queue_size) {
+				count = 0;
+				pending.fetch_or(shootdown_flag_flush_all, std::memory_order_release);
+				return;
+			}
+			ranges[count++] = r;
+			pending.fetch_or(shootdown_flag_range, std::memory_order_release);
+		}
+	};
+
+
+	/*
+	 * shootdown
+	 *
+	 * hart invalidation domain implementing the remote fence
+	 * operations of the Supervisor Binary Interface
+	 *
+	 * hart_mask has one bit per hart, the mask is read from
+	 * supervisor memory by the caller (sbi passes a pointer)
+	 */
+
+	template <typename UX, const size_t max_harts = 64>
+	struct shootdown
+	{
+		typedef shootdown_queue<UX> queue_type;
+
+		static_assert(max_harts <= 64, "hart_mask is 64 bits");
+
+		queue_type queues[max_harts];
+
+		queue_type& queue(size_t hart_id) { return queues[hart_id]; }
+
+		void remote_sfence_vm(u64 hart_mask, UX asid)
+		{
+			for (size_t i = 0; i < max_harts; i++) {
+				if (hart_mask & (1ULL << i)) queues[i].post_asid(asid);
+			}
+		}
+
+		void remote_sfence_vm_range(u64 hart_mask, UX asid, UX start, UX size)
+		{
+			for (size_t i = 0; i < max_harts; i++) {
+				if (hart_mask & (1ULL << i)) queues[i].post_range(asid, start, size);
+			}
+		}
+
+		void remote_sfence_vm_all(u64 hart_mask)
+		{
+			for (size_t i = 0; i < max_harts; i++) {
+				if (hart_mask & (1ULL << i)) queues[i].post_flush_all();
+			}
+		}
+
+		void remote_fence_i(u64 hart_mask)
+		{
+			for (size_t i = 0; i < max_harts; i++) {
+				if (hart_mask & (1ULL << i)) queues[i].post_fence_i();
+			}
+		}
+	};
+
+	typedef shootdown<u32> shootdown_rv32;
+	typedef shootdown<u64> shootdown_rv64;
+
+}
+
+#endif
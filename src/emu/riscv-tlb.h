@@ -12,7 +12,7 @@ namespace riscv {
 	 *
 	 * protection domain and address space tagged virtual to physical mapping with page attributes
 	 *
-	 * tlb[PDID:ASID:VPN] = PPN:PTE.bits:PMA
+	 * tlb[PDID:ASID:VPN] = PPN:PTE.bits:PMA:PMP
 	 */
 
 	template <typename PARAM>
@@ -41,6 +41,7 @@ namespace riscv {
 		UX      pteb : pte_bits;       /* PTE Bits */
 		pdid_t  pdid;                  /* Protection Domain Identifier */
 		pma_t   pma;                   /* Physical Memory Attributes copy */
+		pmp_t   pmp;                   /* Physical Memory Protection page permissions */
 
 		tagged_tlb_entry() :
 			ppn(ppn_limit),
@@ -48,7 +49,8 @@ namespace riscv {
 			vpn(vpn_limit),
 			pteb(0),
 			pdid(-1),
-			pma(0) {}
+			pma(0),
+			pmp(0) {}
 
 		tagged_tlb_entry(UX pdid, UX asid, UX vpn, UX pteb, UX ppn) :
 			ppn(ppn),
@@ -56,7 +58,8 @@ namespace riscv {
 			vpn(vpn),
 			pteb(pteb),
 			pdid(pdid),
-			pma(0) {}
+			pma(0),
+			pmp(0) {}
 	};
 
 
@@ -102,11 +105,20 @@ namespace riscv {
 		void flush(UX pdid, UX asid)
 		{
 			for (size_t i = 0; i < size; i++) {
-				if (tlb[i].pdid != pdid && tlb[i].asid != asid) continue;
+				if (tlb[i].pdid != pdid || tlb[i].asid != asid) continue;
 				tlb[i] = tlb_entry_t();
 			}
 		}
 
+		// flush the TLB entry for the given PDID + ASID + X:12[VA] (direct mapped, single slot)
+		void flush(UX pdid, UX asid, UX va)
+		{
+			UX vpn = va >> page_shift;
+			size_t i = vpn & mask;
+			if (tlb[i].pdid != pdid || tlb[i].asid != asid || tlb[i].vpn != vpn) return;
+			tlb[i] = tlb_entry_t();
+		}
+
 		// lookup TLB entry for the given PDID + ASID + X:12[VA] + 11:0[PTE.bits] -> PPN]
 		tlb_entry_t* lookup(UX pdid, UX asid, UX va)
 		{
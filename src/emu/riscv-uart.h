@@ -0,0 +1,146 @@
+//
+//  riscv-uart.h
+//
+
+#ifndef riscv_uart_h
+#define riscv_uart_h
+
+namespace riscv {
+
+	/* 16550 register offsets (DLAB=0 unless noted) */
+
+	enum uart_reg {
+		uart_reg_rbr   = 0,        /* Receive Buffer Register (read) */
+		uart_reg_thr   = 0,        /* Transmit Holding Register (write) */
+		uart_reg_ier   = 1,        /* Interrupt Enable Register */
+		uart_reg_iir   = 2,        /* Interrupt Identification Register (read) */
+		uart_reg_fcr   = 2,        /* FIFO Control Register (write) */
+		uart_reg_lcr   = 3,        /* Line Control Register */
+		uart_reg_mcr   = 4,        /* Modem Control Register */
+		uart_reg_lsr   = 5,        /* Line Status Register */
+		uart_reg_msr   = 6,        /* Modem Status Register */
+		uart_reg_scr   = 7,        /* Scratch Register */
+		uart_reg_dll   = 0,        /* Divisor Latch Low (DLAB=1) */
+		uart_reg_dlm   = 1,        /* Divisor Latch High (DLAB=1) */
+	};
+
+	enum {
+		uart_ier_rdi   = 0x01,     /* Receive Data Interrupt */
+		uart_ier_thri  = 0x02,     /* Transmit Holding Register Empty Interrupt */
+		uart_iir_none  = 0x01,     /* No interrupt pending */
+		uart_iir_thri  = 0x02,     /* Transmit Holding Register Empty */
+		uart_iir_rdi   = 0x04,     /* Receive Data Available */
+		uart_iir_fifo  = 0xc0,     /* FIFOs enabled */
+		uart_lcr_dlab  = 0x80,     /* Divisor Latch Access Bit */
+		uart_lsr_dr    = 0x01,     /* Data Ready */
+		uart_lsr_thre  = 0x20,     /* Transmit Holding Register Empty */
+		uart_lsr_temt  = 0x40,     /* Transmitter Empty */
+		uart_size      = 8,        /* register window size */
+	};
+
+
+	/*
+	 * uart_16550
+	 *
+	 * 16550 compatible console UART
+	 *
+	 * Transmitted bytes go to a console_writer which batches them into
+	 * host writes from a background thread, so the transmitter is always
+	 * ready. The THRE interrupt is raised when it is enabled and after each
+	 * transmitted byte, and is cleared by reading IIR or disabling it, as
+	 * on a real 16550. Received bytes come from a console_reader which the
+	 * emulator polls at block boundaries.
+	 */
+
+	template <typename UX, typename WRITER = console_writer<>, typename READER = console_reader<>>
+	struct uart_16550
+	{
+		typedef WRITER writer_type;
+		typedef READER reader_type;
+
+		UX           mmio_base;    /* base physical address of the register window */
+		writer_type &writer;
+		reader_type &reader;
+
+		u8 ier;
+		u8 lcr;
+		u8 mcr;
+		u8 scr;
+		u8 dll;
+		u8 dlm;
+		bool thre_pending;         /* THRE interrupt latched until IIR is read */
+
+		uart_16550(UX mmio_base, writer_type &writer, reader_type &reader) :
+			mmio_base(mmio_base), writer(writer), reader(reader),
+			ier(0), lcr(0), mcr(0), scr(0), dll(0), dlm(0), thre_pending(false) {}
+
+		/* poll host input, called at block boundaries */
+		void poll() { reader.poll(); }
+
+		bool irq_pending()
+		{
+			return ((ier & uart_ier_rdi) && reader.available()) || ((ier & uart_ier_thri) && thre_pending);
+		}
+
+		u8 mmio_load(UX offset)
+		{
+			bool dlab = lcr & uart_lcr_dlab;
+			switch (offset) {
+				case uart_reg_rbr:
+				{
+					if (dlab) return dll;
+					int ch = reader.getchar();
+					return ch < 0 ? 0 : u8(ch);
+				}
+				case uart_reg_ier: return dlab ? dlm : ier;
+				case uart_reg_iir:
+					if ((ier & uart_ier_rdi) && reader.available()) return uart_iir_fifo | uart_iir_rdi;
+					if ((ier & uart_ier_thri) && thre_pending) {
+						thre_pending = false;
+						return uart_iir_fifo | uart_iir_thri;
+					}
+					return uart_iir_fifo | uart_iir_none;
+				case uart_reg_lcr: return lcr;
+				case uart_reg_mcr: return mcr;
+				case uart_reg_lsr:
+					return uart_lsr_thre | uart_lsr_temt | (reader.available() ? uart_lsr_dr : 0);
+				case uart_reg_msr: return 0;
+				case uart_reg_scr: return scr;
+				default: return 0;
+			}
+		}
+
+		void mmio_store(UX offset, u8 val)
+		{
+			bool dlab = lcr & uart_lcr_dlab;
+			switch (offset) {
+				case uart_reg_thr:
+					if (dlab) dll = val;
+					else {
+						writer.putchar(val);
+						thre_pending = true;
+					}
+					break;
+				case uart_reg_ier:
+					if (dlab) dlm = val;
+					else {
+						/* enabling THRI with an empty transmitter raises it */
+						if (val & uart_ier_thri) thre_pending = true;
+						ier = val & 0x0f;
+					}
+					break;
+				case uart_reg_fcr: break; /* FIFOs are always enabled */
+				case uart_reg_lcr: lcr = val; break;
+				case uart_reg_mcr: mcr = val; break;
+				case uart_reg_scr: scr = val; break;
+				default: break;
+			}
+		}
+	};
+
+	using uart_16550_rv32 = uart_16550<u32>;
+	using uart_16550_rv64 = uart_16550<u64>;
+
+}
+
+#endif
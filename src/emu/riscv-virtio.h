@@ -0,0 +1,412 @@
+//
+//  riscv-virtio.h
+//
+
+#ifndef riscv_virtio_h
+#define riscv_virtio_h
+
+namespace riscv {
+
+	/* virtio-mmio register offsets (virtio 1.0 section 4.2.2) */
+
+	enum virtio_mmio_reg {
+		virtio_mmio_magic_value         = 0x000,
+		virtio_mmio_version             = 0x004,
+		virtio_mmio_device_id           = 0x008,
+		virtio_mmio_vendor_id           = 0x00c,
+		virtio_mmio_device_features     = 0x010,
+		virtio_mmio_device_features_sel = 0x014,
+		virtio_mmio_driver_features     = 0x020,
+		virtio_mmio_driver_features_sel = 0x024,
+		virtio_mmio_queue_sel           = 0x030,
+		virtio_mmio_queue_num_max       = 0x034,
+		virtio_mmio_queue_num           = 0x038,
+		virtio_mmio_queue_ready         = 0x044,
+		virtio_mmio_queue_notify        = 0x050,
+		virtio_mmio_interrupt_status    = 0x060,
+		virtio_mmio_interrupt_ack       = 0x064,
+		virtio_mmio_status              = 0x070,
+		virtio_mmio_queue_desc_low      = 0x080,
+		virtio_mmio_queue_desc_high     = 0x084,
+		virtio_mmio_queue_driver_low    = 0x090,
+		virtio_mmio_queue_driver_high   = 0x094,
+		virtio_mmio_queue_device_low    = 0x0a0,
+		virtio_mmio_queue_device_high   = 0x0a4,
+		virtio_mmio_config_generation   = 0x0fc,
+		virtio_mmio_config              = 0x100,
+	};
+
+	enum {
+		virtio_mmio_magic               = 0x74726976, /* "virt" */
+		virtio_mmio_version_modern      = 2,
+		virtio_mmio_size                = 0x200,
+		virtio_vendor_id                = 0x554d4551, /* "QEMU" */
+		virtio_device_id_blk            = 2,
+		virtio_status_failed            = 128,
+		virtio_interrupt_used_buffer    = 1,
+		virtio_desc_flag_next           = 1,
+		virtio_desc_flag_write          = 2,
+	};
+
+	enum : u64 {
+		virtio_feature_version_1        = 1ULL << 32,
+		virtio_blk_feature_ro           = 1ULL << 5,
+		virtio_blk_feature_flush        = 1ULL << 9,
+	};
+
+	enum virtio_blk_req_type {
+		virtio_blk_t_in                 = 0,
+		virtio_blk_t_out                = 1,
+		virtio_blk_t_flush              = 4,
+		virtio_blk_t_get_id             = 8,
+	};
+
+	enum virtio_blk_req_status {
+		virtio_blk_s_ok                 = 0,
+		virtio_blk_s_ioerr              = 1,
+		virtio_blk_s_unsupp             = 2,
+	};
+
+	enum {
+		virtio_blk_sector_shift         = 9,
+		virtio_blk_sector_size          = 1 << virtio_blk_sector_shift,
+		virtio_blk_id_bytes             = 20,
+	};
+
+	/* split virtqueue structures (little endian, laid out in guest memory) */
+
+	struct virtq_desc {
+		u64 addr;
+		u32 len;
+		u16 flags;
+		u16 next;
+	};
+
+	struct virtq_avail {
+		u16 flags;
+		u16 idx;
+		u16 ring[];
+	};
+
+	struct virtq_used_elem {
+		u32 id;
+		u32 len;
+	};
+
+	struct virtq_used {
+		u16 flags;
+		u16 idx;
+		virtq_used_elem ring[];
+	};
+
+	struct virtio_blk_req_hdr {
+		u32 type;
+		u32 reserved;
+		u64 sector;
+	};
+
+
+	/*
+	 * virtio_blk
+	 *
+	 * virtio-mmio block device backed by a memory mapped image file
+	 *
+	 * Descriptor buffers are resolved to host pointers with mpa_to_uva
+	 * and copied directly to and from the image mapping, so there are
+	 * no intermediate bounce buffers. All available requests are
+	 * processed on each queue notify and completed with a single used
+	 * index update and interrupt.
+	 */
+
+	template <typename UX, typename MEMORY = user_memory<UX>, const size_t queue_num_max = 256>
+	struct virtio_blk
+	{
+		static_assert(ispow2(queue_num_max), "queue_num_max must be a power of 2");
+
+		MEMORY &mem;               /* guest physical memory */
+		UX      mmio_base;         /* base physical address of the register window */
+
+		int     fd;                /* image file descriptor */
+		u8     *image;             /* image mapping */
+		size_t  image_size;        /* image size in bytes */
+		bool    read_only;         /* image opened read only */
+
+		u64     device_features_sel;
+		u64     driver_features;
+		u32     driver_features_sel;
+		u32     status;
+		u32     interrupt_status;
+		u32     config_generation;
+
+		/* single request queue */
+		u32     queue_num;
+		u32     queue_ready;
+		u64     queue_desc;
+		u64     queue_driver;
+		u64     queue_device;
+		u16     last_avail_idx;
+
+		/* statistics */
+		u64     notify_count;
+		u64     request_count;
+
+		virtio_blk(MEMORY &mem, UX mmio_base) :
+			mem(mem), mmio_base(mmio_base), fd(-1), image(nullptr),
+			image_size(0), read_only(false)
+		{
+			reset();
+		}
+
+		~virtio_blk() { close_image(); }
+
+		/* map the backing image, image size is truncated to a whole sector */
+		bool open_image(const char *filename, bool ro)
+		{
+			struct stat st;
+			close_image();
+			read_only = ro;
+			if ((fd = open(filename, ro ? O_RDONLY : O_RDWR)) < 0) {
+				debug("virtio-blk: error: open: %s: %s", filename, strerror(errno));
+				return false;
+			}
+			if (fstat(fd, &st) < 0) {
+				debug("virtio-blk: error: fstat: %s: %s", filename, strerror(errno));
+				close_image();
+				return false;
+			}
+			image_size = st.st_size & ~size_t(virtio_blk_sector_size - 1);
+			if (image_size == 0) return true;
+			void *addr = mmap(nullptr, image_size, PROT_READ | (ro ? 0 : PROT_WRITE),
+				MAP_SHARED, fd, 0);
+			if (addr == MAP_FAILED) {
+				debug("virtio-blk: error: mmap: %s: %s", filename, strerror(errno));
+				close_image();
+				return false;
+			}
+			image = (u8*)addr;
+			return true;
+		}
+
+		void close_image()
+		{
+			if (image) {
+				munmap(image, image_size);
+				image = nullptr;
+			}
+			if (fd >= 0) {
+				close(fd);
+				fd = -1;
+			}
+			image_size = 0;
+		}
+
+		void reset()
+		{
+			device_features_sel = 0;
+			driver_features = 0;
+			driver_features_sel = 0;
+			status = 0;
+			interrupt_status = 0;
+			config_generation = 0;
+			queue_num = queue_num_max;
+			queue_ready = 0;
+			queue_desc = queue_driver = queue_device = 0;
+			last_avail_idx = 0;
+			notify_count = request_count = 0;
+		}
+
+		u64 device_features()
+		{
+			return virtio_feature_version_1 | virtio_blk_feature_flush |
+				(read_only ? virtio_blk_feature_ro : 0);
+		}
+
+		bool irq_pending() { return interrupt_status != 0; }
+
+		/* translate a guest physical range to a host pointer, the range must be contiguous */
+		void* guest_ptr(u64 mpa, size_t len)
+		{
+			intptr_t uva = mem.mpa_to_uva(UX(mpa));
+			if (uva == -1) return nullptr;
+			if (len > 1 && mem.mpa_to_uva(UX(mpa + len - 1)) != uva + intptr_t(len - 1)) {
+				return nullptr;
+			}
+			return (void*)uva;
+		}
+
+		u32 mmio_load(UX offset)
+		{
+			if (offset >= virtio_mmio_config) {
+				u64 capacity = image_size >> virtio_blk_sector_shift;
+				switch (offset - virtio_mmio_config) {
+					case 0: return u32(capacity);
+					case 4: return u32(capacity >> 32);
+					default: return 0;
+				}
+			}
+			switch (offset) {
+				case virtio_mmio_magic_value:       return virtio_mmio_magic;
+				case virtio_mmio_version:           return virtio_mmio_version_modern;
+				case virtio_mmio_device_id:         return virtio_device_id_blk;
+				case virtio_mmio_vendor_id:         return virtio_vendor_id;
+				case virtio_mmio_device_features:   return u32(device_features() >> (device_features_sel * 32));
+				case virtio_mmio_queue_num_max:     return queue_num_max;
+				case virtio_mmio_queue_ready:       return queue_ready;
+				case virtio_mmio_interrupt_status:  return interrupt_status;
+				case virtio_mmio_status:            return status;
+				case virtio_mmio_config_generation: return config_generation;
+				default: return 0;
+			}
+		}
+
+		void mmio_store(UX offset, u32 val)
+		{
+			switch (offset) {
+				case virtio_mmio_device_features_sel: device_features_sel = val & 1; break;
+				case virtio_mmio_driver_features:
+					driver_features = (driver_features_sel ?
+						(driver_features & 0xffffffffULL) | (u64(val) << 32) :
+						(driver_features & ~0xffffffffULL) | val);
+					break;
+				case virtio_mmio_driver_features_sel: driver_features_sel = val & 1; break;
+				case virtio_mmio_queue_sel:           break; /* single queue */
+				case virtio_mmio_queue_num:
+					queue_num = (val && val <= queue_num_max && ispow2(val)) ? val : queue_num_max;
+					break;
+				case virtio_mmio_queue_ready:         queue_ready = val & 1; break;
+				case virtio_mmio_queue_notify:        if (val == 0) notify(); break;
+				case virtio_mmio_interrupt_ack:       interrupt_status &= ~val; break;
+				case virtio_mmio_status:              if (val == 0) reset(); else status = val; break;
+				case virtio_mmio_queue_desc_low:      queue_desc = (queue_desc & ~0xffffffffULL) | val; break;
+				case virtio_mmio_queue_desc_high:     queue_desc = (queue_desc & 0xffffffffULL) | (u64(val) << 32); break;
+				case virtio_mmio_queue_driver_low:    queue_driver = (queue_driver & ~0xffffffffULL) | val; break;
+				case virtio_mmio_queue_driver_high:   queue_driver = (queue_driver & 0xffffffffULL) | (u64(val) << 32); break;
+				case virtio_mmio_queue_device_low:    queue_device = (queue_device & ~0xffffffffULL) | val; break;
+				case virtio_mmio_queue_device_high:   queue_device = (queue_device & 0xffffffffULL) | (u64(val) << 32); break;
+				default: break;
+			}
+		}
+
+		/* process all available descriptor chains, then publish the used index once */
+		void notify()
+		{
+			if (!queue_ready) return;
+
+			virtq_desc *desc = (virtq_desc*)guest_ptr(queue_desc, sizeof(virtq_desc) * queue_num);
+			virtq_avail *avail = (virtq_avail*)guest_ptr(queue_driver, sizeof(virtq_avail) + 2 * queue_num);
+			virtq_used *used = (virtq_used*)guest_ptr(queue_device,
+				sizeof(virtq_used) + sizeof(virtq_used_elem) * queue_num);
+			if (!desc || !avail || !used) {
+				status |= virtio_status_failed;
+				return;
+			}
+
+			notify_count++;
+			u16 avail_idx = __atomic_load_n(&avail->idx, __ATOMIC_ACQUIRE);
+			u16 used_idx = used->idx;
+			size_t completed = 0;
+			while (last_avail_idx != avail_idx) {
+				u16 head = avail->ring[last_avail_idx & (queue_num - 1)];
+				virtq_used_elem &elem = used->ring[used_idx & (queue_num - 1)];
+				elem.id = head;
+				elem.len = process_request(desc, head);
+				last_avail_idx++;
+				used_idx++;
+				completed++;
+			}
+			request_count += completed;
+
+			if (completed) {
+				__atomic_store_n(&used->idx, used_idx, __ATOMIC_RELEASE);
+				interrupt_status |= virtio_interrupt_used_buffer;
+			}
+		}
+
+		/* process one request chain and return the number of bytes written to the guest */
+		u32 process_request(virtq_desc *desc, u16 head)
+		{
+			virtq_desc *chain[queue_num_max];
+			size_t n = 0;
+			u16 i = head;
+
+			/* header descriptor, zero or more data descriptors, status descriptor */
+			for (;;) {
+				if (i >= queue_num || n == queue_num) return 0;
+				chain[n++] = &desc[i];
+				if (!(desc[i].flags & virtio_desc_flag_next)) break;
+				i = desc[i].next;
+			}
+			if (n < 2) return 0;
+
+			virtq_desc *hdr_desc = chain[0], *status_desc = chain[n - 1];
+			virtio_blk_req_hdr *hdr = (virtio_blk_req_hdr*)guest_ptr(hdr_desc->addr, sizeof(virtio_blk_req_hdr));
+			u8 *req_status = (u8*)guest_ptr(status_desc->addr, 1);
+			if (!hdr || !req_status || hdr_desc->len < sizeof(virtio_blk_req_hdr) ||
+				status_desc->len < 1 || !(status_desc->flags & virtio_desc_flag_write)) return 0;
+
+			/* reject sectors past the image before shifting so the offset can't wrap */
+			u64 offset = hdr->sector <= (image_size >> virtio_blk_sector_shift) ?
+				hdr->sector << virtio_blk_sector_shift : image_size + 1;
+			u32 written = 1;
+			u8 result = virtio_blk_s_ok;
+
+			switch (hdr->type) {
+				case virtio_blk_t_in:
+				case virtio_blk_t_out:
+				{
+					bool is_read = hdr->type == virtio_blk_t_in;
+					if (!is_read && read_only) {
+						result = virtio_blk_s_ioerr;
+						break;
+					}
+					for (size_t j = 1; j < n - 1 && result == virtio_blk_s_ok; j++) {
+						size_t len = chain[j]->len;
+						u8 *data = (u8*)guest_ptr(chain[j]->addr, len);
+						if (!data || offset > image_size || len > image_size - offset ||
+							is_read != bool(chain[j]->flags & virtio_desc_flag_write)) {
+							result = virtio_blk_s_ioerr;
+							break;
+						}
+						if (is_read) {
+							memcpy(data, image + offset, len);
+							written += len;
+						} else {
+							memcpy(image + offset, data, len);
+						}
+						offset += len;
+					}
+					break;
+				}
+				case virtio_blk_t_flush:
+					if (image && msync(image, image_size, MS_SYNC) != 0) {
+						result = virtio_blk_s_ioerr;
+					}
+					break;
+				case virtio_blk_t_get_id:
+				{
+					u8 *data = n == 3 ? (u8*)guest_ptr(chain[1]->addr, chain[1]->len) : nullptr;
+					if (!data || chain[1]->len < virtio_blk_id_bytes ||
+						!(chain[1]->flags & virtio_desc_flag_write)) {
+						result = virtio_blk_s_ioerr;
+						break;
+					}
+					memset(data, 0, virtio_blk_id_bytes);
+					strncpy((char*)data, "riscv-virtio-blk", virtio_blk_id_bytes);
+					written += virtio_blk_id_bytes;
+					break;
+				}
+				default:
+					result = virtio_blk_s_unsupp;
+					break;
+			}
+			*req_status = result;
+			return written;
+		}
+	};
+
+	using virtio_blk_rv32 = virtio_blk<u32>;
+	using virtio_blk_rv64 = virtio_blk<u64>;
+
+}
+
+#endif
@@ -28,6 +28,108 @@ std::vector<cmdline_option> riscv_gen_constraints::get_cmdline_options()
 	};
 }
 
+/* operand name, comparison and bound of one term of a constraint expression */
+static bool parse_term(std::string term, std::string &var, std::string &cmp, long long &val)
+{
+	std::vector<std::string> comps = split(ltrim(rtrim(term)), " ", false);
+	if (comps.size() != 3) return false;
+	char *end;
+	val = strtoll(comps[2].c_str(), &end, 10);
+	if (*end != '\0') return false;
+	var = comps[0];
+	cmp = comps[1];
+	return true;
+}
+
+/*
+ * branch-free form of a constraint expression: a range check on one
+ * operand becomes a single unsigned compare and other conjunctions are
+ * evaluated without short circuit
+ */
+static std::string constraint_predicate(std::string expression)
+{
+	std::vector<std::string> terms;
+	size_t i, j = 0;
+	while ((i = expression.find("&&", j)) != std::string::npos) {
+		terms.push_back(ltrim(rtrim(expression.substr(j, i - j))));
+		j = i + 2;
+	}
+	terms.push_back(ltrim(rtrim(expression.substr(j))));
+	if (terms.size() == 1) return expression;
+
+	std::string lo_var, lo_cmp, hi_var, hi_cmp;
+	long long lo, hi;
+	if (terms.size() == 2 &&
+		parse_term(terms[0], lo_var, lo_cmp, lo) && parse_term(terms[1], hi_var, hi_cmp, hi) &&
+		lo_var == hi_var && lo_cmp == ">=" && (hi_cmp == "<" || hi_cmp == "<="))
+	{
+		long long range = hi - lo + (hi_cmp == "<=" ? 1 : 0);
+		return lo < 0 ?
+			format_string("uint32_t(%s) + %lldu < %lldu", lo_var.c_str(), -lo, range) :
+			format_string("uint32_t(%s) - %lldu < %lldu", lo_var.c_str(), lo, range);
+	}
+
+	std::string predicate;
+	for (auto &term : terms) {
+		if (predicate.size() > 0) predicate += " & ";
+		predicate += "(" + term + ")";
+	}
+	return predicate;
+}
+
+/* conjunction of the branch-free predicates of a constraint list */
+static std::string constraint_list_predicate(riscv_constraint_list &constraint_list)
+{
+	if (constraint_list.size() == 1) {
+		return constraint_predicate(constraint_list[0]->expression);
+	}
+	std::string predicate;
+	for (auto &constraint : constraint_list) {
+		if (predicate.size() > 0) predicate += " & ";
+		predicate += "(" + constraint_predicate(constraint->expression) + ")";
+	}
+	return predicate.size() > 0 ? predicate : "true";
+}
+
+/*
+ * switch on the opcode returning the first pseudo opcode, or the first
+ * compressed opcode for isa_width, whose constraints hold
+ */
+static void print_constraint_switch(riscv_gen *gen, std::string name, size_t isa_width)
+{
+	printf("template <typename T>\n");
+	printf("inline int %s(T &dec)\n", name.c_str());
+	printf("{\n");
+	printf("\tauto imm = dec.imm;\n");
+	printf("\tauto rd = dec.rd, rs1 = dec.rs1, rs2 = dec.rs2;\n");
+	printf("\tswitch (dec.op) {\n");
+	for (auto &opcode : gen->opcodes) {
+		std::vector<std::pair<riscv_opcode_ptr,riscv_constraint_list*>> candidates;
+		if (isa_width == 0) {
+			for (auto &pseudo : opcode->pseudos) {
+				candidates.push_back(std::make_pair(pseudo->pseudo_opcode, &pseudo->constraint_list));
+			}
+		} else {
+			for (auto &comp : opcode->compressions) {
+				if (!opcode->include_isa(isa_width) || !comp->comp_opcode->include_isa(isa_width)) continue;
+				candidates.push_back(std::make_pair(comp->comp_opcode, &comp->constraint_list));
+			}
+		}
+		if (candidates.size() == 0) continue;
+		printf("\t\tcase %s:\n", riscv_meta_model::opcode_format("riscv_op_", opcode, "_").c_str());
+		for (auto &candidate : candidates) {
+			printf("\t\t\tif (%s) return %s;\n",
+				constraint_list_predicate(*candidate.second).c_str(),
+				riscv_meta_model::opcode_format("riscv_op_", candidate.first, "_").c_str());
+		}
+		printf("\t\t\tbreak;\n");
+	}
+	printf("\t\tdefault: break;\n");
+	printf("\t}\n");
+	printf("\treturn riscv_op_illegal;\n");
+	printf("}\n\n");
+}
+
 static void print_constraints_h(riscv_gen *gen)
 {
 	static const char* kConstraintsHeader =
@@ -96,6 +198,11 @@ R"C(#endif
 	}
 	printf("%s", kConstraintsCheckFooter);
 
+	print_constraint_switch(gen, "decode_pseudo_op", 0);
+	for (auto isa_width : gen->isa_width_prefixes()) {
+		print_constraint_switch(gen, "compress_op_" + isa_width.second, isa_width.first);
+	}
+
 	printf("%s", kConstraintsSetHeader);
 	for (auto &constraint : gen->constraints) {
 		if (constraint->name.find("_eq_") == std::string::npos) continue;
@@ -27,6 +27,79 @@ std::vector<cmdline_option> riscv_gen_interp::get_cmdline_options()
 	};
 }
 
+/* opcodes whose only effect is to write rd, canonicalized to nop when rd is x0 */
+static bool writes_rd_only(riscv_opcode_ptr opcode)
+{
+	if (opcode->is_pseudo() && opcode->pseudo) opcode = opcode->pseudo->real_opcode;
+	if (opcode->compressed) return false;
+	const std::string &code = opcode->pseudocode_c;
+	return code.find("rd = ") == 0 && code.find(";") == std::string::npos &&
+		code.find("*(") == std::string::npos && code.find("frs") == std::string::npos &&
+		code.find("fcsr") == std::string::npos;
+}
+
+/* pseudo opcodes with an interpreter case, in constraint order */
+static std::vector<riscv_pseudo_ptr> canonical_pseudos(riscv_opcode_ptr opcode)
+{
+	std::vector<riscv_pseudo_ptr> pseudos;
+	for (auto &pseudo : opcode->pseudos) {
+		if (pseudo->pseudo_opcode == opcode) continue;
+		if (pseudo->pseudo_opcode->pseudocode_c.size() == 0) continue;
+		bool rd_eq_x0 = false;
+		for (auto &constraint : pseudo->constraint_list) {
+			if (constraint->name == "rd_eq_x0") rd_eq_x0 = true;
+		}
+		if (rd_eq_x0 && writes_rd_only(opcode)) continue;
+		pseudos.push_back(pseudo);
+	}
+	return pseudos;
+}
+
+static void print_canonicalize(riscv_gen *gen, size_t isa_width, std::string isa_prefix)
+{
+	riscv_opcode_ptr nop_opcode;
+	for (auto &opcode : gen->opcodes) {
+		if (opcode->name == "@nop") nop_opcode = opcode;
+	}
+	if (!nop_opcode) panic("canonicalize: missing nop pseudo opcode");
+
+	printf("/* Canonicalize Instruction RV%lu */\n\n", isa_width);
+	printf("template <typename T>\n");
+	printf("void canonicalize_inst_%s(T &dec)\n", isa_prefix.c_str());
+	printf("{\n");
+	printf("\tusing namespace riscv;\n");
+	printf("\tauto imm = dec.imm;\n");
+	printf("\tauto rd = dec.rd, rs1 = dec.rs1, rs2 = dec.rs2;\n");
+	printf("\n");
+	printf("\tswitch (dec.op) {\n");
+	for (auto &opcode : gen->opcodes) {
+		if (opcode->is_pseudo() || opcode->compressed) continue;
+		if (!opcode->include_isa(isa_width)) continue;
+		bool rd_only = writes_rd_only(opcode);
+		auto pseudos = canonical_pseudos(opcode);
+		if (!rd_only && pseudos.size() == 0) continue;
+		printf("\t\tcase %s:\n", riscv_meta_model::opcode_format("riscv_op_", opcode, "_").c_str());
+		if (rd_only) {
+			printf("\t\t\tif (rd == 0) { dec.op = %s; break; }\n",
+				riscv_meta_model::opcode_format("riscv_op_", nop_opcode, "_").c_str());
+		}
+		for (auto &pseudo : pseudos) {
+			std::string cond;
+			for (auto &constraint : pseudo->constraint_list) {
+				if (cond.size() > 0) cond += " && ";
+				cond += "(" + constraint->expression + ")";
+			}
+			printf("\t\t\tif (%s) { dec.op = %s; break; }\n", cond.size() ? cond.c_str() : "true",
+				riscv_meta_model::opcode_format("riscv_op_", pseudo->pseudo_opcode, "_").c_str());
+		}
+		printf("\t\t\treturn;\n");
+	}
+	printf("\t\tdefault: return;\n");
+	printf("\t}\n");
+	printf("\tdec.codec = riscv_inst_codec[dec.op];\n");
+	printf("}\n\n");
+}
+
 static void print_interp_h(riscv_gen *gen)
 {
 	printf(kCHeader, "riscv-interp.h");
@@ -100,7 +173,8 @@ static void print_interp_h(riscv_gen *gen)
 			inst = replace(inst, "frd", "FRD");
 			inst = replace(inst, "frs1", "FRS1");
 			inst = replace(inst, "frs2", "FRS2");
-			inst = replace(inst, "rd", "if (dec.rd > 0) proc.ireg[dec.rd]");
+			inst = replace(inst, "rd", writes_rd_only(opcode) ?
+				"proc.ireg[dec.rd]" : "if (dec.rd > 0) proc.ireg[dec.rd]");
 			inst = replace(inst, "rs1", "proc.ireg[dec.rs1]");
 			inst = replace(inst, "rs2", "proc.ireg[dec.rs2]");
 			inst = replace(inst, "FRD", "frd");
@@ -121,6 +195,9 @@ static void print_interp_h(riscv_gen *gen)
 		printf("\treturn pc_offset;\n");
 		printf("}\n\n");
 	}
+	for (auto isa_width : gen->isa_width_prefixes()) {
+		print_canonicalize(gen, isa_width.first, isa_width.second);
+	}
 	printf("#endif\n");
 }
 
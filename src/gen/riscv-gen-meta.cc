@@ -43,6 +43,98 @@ static void print_array_illegal_uint64(uint64_t num, bool no_comment)
 	printf("\t%s0x%016" PRIx64 ",\n", no_comment ? "" : unknown_op_comment, num);
 }
 
+/* per-opcode properties derived from operands, codecs and extensions */
+struct riscv_inst_props
+{
+	uint8_t reg_src;
+	uint8_t reg_dst;
+	uint8_t mem_width;
+	bool fp;
+	std::string mem;
+	std::string flow;
+	std::string latency;
+};
+
+static int64_t enum_value(riscv_gen *gen, std::string group, std::string name)
+{
+	for (auto &enumv : gen->enums) {
+		if (enumv->group == group && enumv->name == name) return enumv->value;
+	}
+	return 0;
+}
+
+static riscv_inst_props opcode_props(riscv_gen *gen, riscv_opcode_ptr opcode)
+{
+	/* compressed and pseudo opcodes take the properties of the opcode they
+	   expand to, less any register operand constrained to x0 */
+	riscv_opcode_ptr base;
+	riscv_constraint_list *constraint_list = nullptr;
+	if (opcode->compressed) {
+		base = opcode->compressed->decomp_opcode;
+		constraint_list = &opcode->compressed->constraint_list;
+	} else if (opcode->pseudo && opcode->pseudo->real_opcode != opcode) {
+		base = opcode->pseudo->real_opcode;
+		constraint_list = &opcode->pseudo->constraint_list;
+	}
+	if (base) {
+		riscv_inst_props props = opcode_props(gen, base);
+		bool link = true, rs1_ra = false;
+		for (auto &constraint : *constraint_list) {
+			std::string name = constraint->name;
+			if (name.size() > 6 && name.substr(name.size() - 6) == "_eq_x0") {
+				uint8_t bit = uint8_t(enum_value(gen, "reg", name.substr(0, name.size() - 6)));
+				props.reg_src &= ~bit;
+				props.reg_dst &= ~bit;
+			}
+			if (name == "rd_eq_x0") link = false;
+			if (name == "rs1_eq_ra") rs1_ra = true;
+		}
+		if (!link && props.flow == "call") props.flow = "jump";
+		if (!link && props.flow == "call_indirect") props.flow = rs1_ra ? "return" : "jump_indirect";
+		return props;
+	}
+
+	riscv_inst_props props = { 0, 0, 0, false, "none", "none", "alu" };
+	for (auto &operand : opcode->operands) {
+		uint8_t bit = uint8_t(enum_value(gen, "reg", operand->name));
+		if (operand->name == "rd" || operand->name == "frd") props.reg_dst |= bit;
+		else props.reg_src |= bit;
+		if (operand->type == "freg") props.fp = true;
+	}
+
+	char alpha = opcode->extensions.size() > 0 ? opcode->extensions.front()->alpha_code : 'i';
+	std::string codec = opcode->codec ? opcode->codec->name : "none";
+	std::string name = opcode->name;
+	if (alpha == 'f' || alpha == 'd' || alpha == 'q') props.fp = true;
+
+	/* width from the size suffix of the mnemonic: lb, sh, flw, lr.w, amoadd.d */
+	if (codec == "i+l" || codec == "i+lf") props.mem = "load";
+	else if (codec == "s" || codec == "s+f") props.mem = "store";
+	else if (codec == "r·a" || codec == "r·l") props.mem = "amo";
+	if (props.mem != "none") {
+		size_t dot = name.find('.');
+		char size = dot != std::string::npos ? name[dot + 1] : name[name[0] == 'f' ? 2 : 1];
+		props.mem_width = size == 'b' ? 1 : size == 'h' ? 2 : size == 'w' ? 4 : size == 'd' ? 8 : 16;
+	}
+
+	if (codec == "sb") props.flow = "branch";
+	else if (codec == "uj") props.flow = "call";
+	else if (name == "jalr") props.flow = "call_indirect";
+	else if (name == "ecall" || name == "ebreak" ||
+		(alpha == 's' && name.size() == 4 && name.substr(1) == "ret")) props.flow = "trap";
+
+	if (props.mem != "none") props.latency = props.mem;
+	else if (props.flow != "none" && props.flow != "trap") props.latency = "branch";
+	else if (alpha == 'm') props.latency = name.find("div") == 0 || name.find("rem") == 0 ? "div" : "mul";
+	else if (props.fp) {
+		props.latency = name.find("fdiv") == 0 || name.find("fsqrt") == 0 ? "fdiv" :
+			name.find("fmadd") == 0 || name.find("fmsub") == 0 ||
+			name.find("fnmadd") == 0 || name.find("fnmsub") == 0 ? "fmadd" : "fpu";
+	}
+	else if (alpha == 's' || codec == "r·f" || name == "fence.i") props.latency = "system";
+	return props;
+}
+
 static void print_meta_h(riscv_gen *gen)
 {
 	static const char* kMetaHeader =
@@ -73,6 +165,19 @@ struct riscv_comp_data
 	const rvc_constraint* constraints;
 };
 
+/* Instruction property structure */
+struct riscv_props_data
+{
+	const unsigned char reg_src;     /* riscv_reg mask of register operands read */
+	const unsigned char reg_dst;     /* riscv_reg mask of register operands written */
+	const unsigned char mem;         /* riscv_mem class */
+	const unsigned char mem_width;   /* memory access width in bytes */
+	const unsigned char flow;        /* riscv_flow class */
+	const unsigned char latency;     /* riscv_latency class */
+	const unsigned char fp;          /* uses floating point registers */
+	const unsigned char reserved;
+};
+
 /* Instruction operand structure */
 struct riscv_operand_data
 {
@@ -92,6 +197,7 @@ extern const riscv::inst_t riscv_inst_match[];
 extern const riscv::inst_t riscv_inst_mask[];
 extern const riscv_comp_data* riscv_inst_pseudo[];
 extern const riscv_comp_data riscv_inst_depseudo[];
+extern const riscv_props_data riscv_inst_props[];
 )C";
 
 	static const char* kMetaFooter =
@@ -246,6 +352,21 @@ R"C(
 	}
 	printf("};\n\n");
 
+	// Opcode count, one past the highest opcode number
+	size_t op_count = 1;
+	for (auto &opcode : gen->opcodes) op_count = std::max(op_count, size_t(opcode->num) + 1);
+	printf("enum { riscv_op_count = %zu };\n\n", op_count);
+
+	// Metadata digest, includes the opcode numbering and encodings derived from it
+	uint64_t digest = gen->digest;
+	for (auto &opcode : gen->opcodes) {
+		digest = riscv_meta_model::digest_update(digest, format_string("%s=%lu:%llx:%llx",
+			riscv_meta_model::opcode_format("", opcode, ".").c_str(), opcode->num,
+			opcode->match, opcode->mask));
+	}
+	printf("/* Metadata digest, changes whenever the generated tables may change */\n\n");
+	printf("static const unsigned long long riscv_meta_digest = 0x%016" PRIx64 "ULL;\n\n", digest);
+
 	// Array declarations
 	printf("%s", kMetaDeclarations);
 	for (auto isa_width : gen->isa_width_prefixes()) {
@@ -461,6 +582,18 @@ R"C(#include "riscv-types.h"
 	}
 	printf("};\n\n");
 
+	// Instruction properties
+	printf("const riscv_props_data riscv_inst_props[] = {\n");
+	print_array_illegal_enum("{ 0x00, 0x00, riscv_mem_none, 0, riscv_flow_none, riscv_latency_alu, 0, 0 }", no_comment);
+	for (auto &opcode : gen->opcodes) {
+		riscv_inst_props props = opcode_props(gen, opcode);
+		printf("\t%s{ 0x%02x, 0x%02x, riscv_mem_%s, %u, riscv_flow_%s, riscv_latency_%s, %u, 0 },\n",
+			riscv_meta_model::opcode_comment(opcode, no_comment).c_str(),
+			props.reg_src, props.reg_dst, props.mem.c_str(), props.mem_width,
+			props.flow.c_str(), props.latency.c_str(), props.fp);
+	}
+	printf("};\n\n");
+
 	// Pseudoinstruction constraints
 	for (auto &opcode : gen->opcodes) {
 		if (!opcode->pseudo) continue;
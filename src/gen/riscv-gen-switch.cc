@@ -24,6 +24,9 @@ std::vector<cmdline_option> riscv_gen_switch::get_cmdline_options()
 		{ "-S", "--print-switch-h", cmdline_arg_type_none,
 			"Print switch header",
 			[&](std::string s) { return gen->set_option("print_switch_h"); } },
+		{ "-ST", "--print-switch-table-h", cmdline_arg_type_none,
+			"Print switch table header",
+			[&](std::string s) { return gen->set_option("print_switch_table_h"); } },
 	};
 }
 
@@ -180,10 +183,306 @@ static void print_switch_h(riscv_gen *gen)
 	printf("#endif\n");
 }
 
+/*
+ * decode table
+ *
+ * The codec tree is flattened into an array of nodes, each indexing a
+ * run of entries with up to two bit ranges of the instruction. Entries
+ * are either an opcode or a link to the next node. Nodes with wide
+ * indices are sparse and hold a key list with the default entry
+ * following the keyed entries.
+ *
+ * Dense nodes are merged with their children while the combined index
+ * fits, so the root resolves the compressed quadrant and funct3 or the
+ * major opcode, and most 32-bit instructions need one more lookup on
+ * funct3 and funct7.
+ */
+
+static const ssize_t kMaxDenseTableBits = 12;
+
+struct riscv_decode_table_ent
+{
+	ssize_t link;                        /* node index or -1 for a leaf */
+	std::string leaf;                    /* opcode expression */
+};
+
+struct riscv_decode_table_node
+{
+	std::vector<ssize_t> bits;           /* index bits, msb first */
+	std::vector<ssize_t> keys;           /* sparse node keys */
+	std::vector<riscv_decode_table_ent> ents;
+
+	bool sparse() { return keys.size() > 0; }
+};
+
+static std::string decode_table_leaf(riscv_opcode_list &opcode_list)
+{
+	// mirrors the conditionals emitted by print_switch_decoder_node
+	std::vector<size_t> opcode_widths;
+	for (auto opcode : opcode_list) {
+		for (auto &ext : opcode->extensions) {
+			if (std::find(opcode_widths.begin(), opcode_widths.end(),
+					ext->isa_width) == opcode_widths.end()) {
+				opcode_widths.push_back(ext->isa_width);
+			}
+		}
+	}
+	std::string expr;
+	if (opcode_list.size() > 1 && opcode_list.size() == opcode_widths.size()) {
+		for (auto opcode : opcode_list) {
+			expr += format_string("%s && rv%lu ? %s : ",
+				riscv_meta_model::opcode_isa_shortname(opcode).c_str(),
+				opcode->extensions.front()->isa_width,
+				riscv_meta_model::opcode_format("riscv_op_", opcode, "_").c_str());
+		}
+	} else {
+		auto opcode = opcode_list.front();
+		if (opcode_widths.size() == 1) {
+			expr = format_string("%s && rv%lu ? %s : ",
+				riscv_meta_model::opcode_isa_shortname(opcode).c_str(),
+				opcode->extensions.front()->isa_width,
+				riscv_meta_model::opcode_format("riscv_op_", opcode, "_").c_str());
+		} else {
+			expr = format_string("%s ? %s : ",
+				riscv_meta_model::opcode_isa_shortname(opcode).c_str(),
+				riscv_meta_model::opcode_format("riscv_op_", opcode, "_").c_str());
+		}
+	}
+	return expr + "riscv_op_illegal";
+}
+
+static size_t flatten_decode_table(std::vector<riscv_decode_table_node> &nodes, riscv_codec_node &node)
+{
+	size_t index = nodes.size();
+	nodes.push_back(riscv_decode_table_node());
+
+	// resolve entries, recursing into child nodes
+	std::map<ssize_t,riscv_decode_table_ent> val_ents;
+	for (auto &val : node.vals) {
+		auto &opcode_list = node.val_opcodes[val];
+		auto &child = node.val_decodes[val];
+		if (child.bits.size() == 0 && opcode_list.size() >= 1) {
+			val_ents[val] = riscv_decode_table_ent{ -1, decode_table_leaf(opcode_list) };
+		} else if (child.bits.size() > 0) {
+			ssize_t link = flatten_decode_table(nodes, child);
+			val_ents[val] = riscv_decode_table_ent{ link, "" };
+		} else {
+			val_ents[val] = riscv_decode_table_ent{ -1, "riscv_op_illegal" };
+		}
+	}
+	auto di = val_ents.find(riscv_meta_model::DEFAULT);
+	riscv_decode_table_ent def = di != val_ents.end() ? di->second :
+		riscv_decode_table_ent{ -1, "riscv_op_illegal" };
+
+	riscv_decode_table_node &n = nodes[index];
+	n.bits = node.bits;
+	if (ssize_t(node.bits.size()) <= kMaxDenseTableBits) {
+		n.ents.assign(size_t(1) << node.bits.size(), def);
+		for (auto &ent : val_ents) {
+			if (ent.first != riscv_meta_model::DEFAULT) n.ents[ent.first] = ent.second;
+		}
+	} else {
+		for (auto &ent : val_ents) {
+			if (ent.first == riscv_meta_model::DEFAULT) continue;
+			n.keys.push_back(ent.first);
+			n.ents.push_back(ent.second);
+		}
+		n.ents.push_back(def);
+	}
+	return index;
+}
+
+/* value of the bits in sub for an index over the bits in all */
+static size_t decode_table_subindex(size_t idx, std::vector<ssize_t> &all, std::vector<ssize_t> &sub)
+{
+	size_t val = 0;
+	for (auto bit : sub) {
+		size_t pos = all.size() - 1 - (std::find(all.begin(), all.end(), bit) - all.begin());
+		val = (val << 1) | ((idx >> pos) & 1);
+	}
+	return val;
+}
+
+static bool merge_decode_table_node(std::vector<riscv_decode_table_node> &nodes, size_t index)
+{
+	if (nodes[index].sparse()) return false;
+
+	// union of the node bits with the bits of its children
+	std::set<ssize_t> bit_set(nodes[index].bits.begin(), nodes[index].bits.end());
+	bool has_link = false;
+	for (auto &ent : nodes[index].ents) {
+		if (ent.link < 0) continue;
+		if (nodes[ent.link].sparse()) return false;
+		bit_set.insert(nodes[ent.link].bits.begin(), nodes[ent.link].bits.end());
+		has_link = true;
+	}
+	std::vector<ssize_t> bits(bit_set.rbegin(), bit_set.rend());
+	if (!has_link || ssize_t(bits.size()) > kMaxDenseTableBits ||
+		riscv_meta_model::bitmask_to_bitrange(bits).size() > 2) return false;
+
+	// expand parent and child entries over the combined index
+	riscv_decode_table_node &n = nodes[index];
+	std::vector<riscv_decode_table_ent> ents(size_t(1) << bits.size());
+	for (size_t idx = 0; idx < ents.size(); idx++) {
+		riscv_decode_table_ent &ent = n.ents[decode_table_subindex(idx, bits, n.bits)];
+		if (ent.link < 0) {
+			ents[idx] = ent;
+		} else {
+			riscv_decode_table_node &child = nodes[ent.link];
+			ents[idx] = child.ents[decode_table_subindex(idx, bits, child.bits)];
+		}
+	}
+	n.bits = bits;
+	n.ents = ents;
+	return true;
+}
+
+/* merge nodes top down and renumber the reachable nodes in depth first order */
+static size_t compact_decode_table(std::vector<riscv_decode_table_node> &nodes,
+	std::vector<riscv_decode_table_node> &out, std::map<size_t,size_t> &renumber, size_t index)
+{
+	// merged parents replicate links, so a node can be reached more than once
+	auto ri = renumber.find(index);
+	if (ri != renumber.end()) return ri->second;
+	while (merge_decode_table_node(nodes, index));
+	size_t out_index = out.size();
+	renumber[index] = out_index;
+	out.push_back(riscv_decode_table_node());
+	riscv_decode_table_node n = nodes[index];
+	for (auto &ent : n.ents) {
+		if (ent.link >= 0) ent.link = compact_decode_table(nodes, out, renumber, ent.link);
+	}
+	out[out_index] = n;
+	return out_index;
+}
+
+static void print_switch_table_h(riscv_gen *gen)
+{
+	std::vector<riscv_decode_table_node> tree, nodes;
+	std::map<size_t,size_t> renumber;
+	flatten_decode_table(tree, gen->root_node);
+	compact_decode_table(tree, nodes, renumber, 0);
+
+	printf(kCHeader, "riscv-table.h");
+	printf("#ifndef riscv_table_h\n");
+	printf("#define riscv_table_h\n");
+	printf("\n");
+
+	// print node table
+	printf("/* Decode Table Nodes */\n\n");
+	printf("enum { decode_table_link = 0x8000 };\n\n");
+	printf("struct decode_table_node\n");
+	printf("{\n");
+	printf("\tuint8_t  shift1;    /* index = ((inst >> shift1) & mask1) | ((inst >> shift2) & mask2) */\n");
+	printf("\tuint8_t  shift2;\n");
+	printf("\tuint16_t base;      /* first entry */\n");
+	printf("\tuint32_t mask1;\n");
+	printf("\tuint32_t mask2;\n");
+	printf("\tuint16_t count;     /* number of keys in a sparse node, 0 if dense */\n");
+	printf("\tuint16_t key_base;  /* first key of a sparse node */\n");
+	printf("};\n\n");
+	printf("static const decode_table_node decode_table_nodes[] = {\n");
+	std::vector<std::string> comments;
+	size_t base = 0, key_base = 0;
+	for (auto &n : nodes) {
+		// index is the concatenation of up to two bit ranges, msb first
+		std::vector<riscv_bitrange> ranges = riscv_meta_model::bitmask_to_bitrange(n.bits);
+		if (ranges.size() > 2) {
+			panic("decode table node with more than two bit ranges: %s",
+				riscv_meta_model::format_bitmask(n.bits, "inst", true).c_str());
+		}
+		ssize_t pos = n.bits.size();
+		ssize_t shift[2] = { 0, 0 };
+		uint32_t mask[2] = { 0, 0 };
+		for (size_t i = 0; i < ranges.size(); i++) {
+			ssize_t w = ranges[i].msb - ranges[i].lsb + 1;
+			pos -= w;
+			shift[i] = ranges[i].lsb - pos;
+			mask[i] = ((1U << w) - 1) << pos;
+		}
+		std::string comment = riscv_meta_model::format_bitmask(n.bits, "inst", true);
+		comment = comment.substr(comment.find("/* ") + 3);
+		comment = comment.substr(0, comment.find(" */"));
+		comments.push_back(comment);
+		printf("\t{ %2lu, %2lu, %5lu, 0x%08x, 0x%08x, %3lu, %3lu }, /* %s */\n",
+			shift[0], shift[1], base, mask[0], mask[1], n.keys.size(),
+			n.sparse() ? key_base : 0, comment.c_str());
+		base += n.ents.size();
+		key_base += n.keys.size();
+	}
+	printf("};\n\n");
+	printf("static const uint32_t decode_table_keys[] = {\n");
+	for (auto &n : nodes) {
+		for (auto &key : n.keys) printf("\t%lu,\n", key);
+	}
+	if (key_base == 0) printf("\t0\n");
+	printf("};\n\n");
+
+	// print entry table
+	std::vector<std::string> mnems = gen->get_inst_mnemonics(true, true);
+	std::string params, args;
+	for (auto mi = mnems.begin(); mi != mnems.end(); mi++) {
+		params += (mi != mnems.begin() ? ", bool " : "bool ") + *mi;
+		args += (mi != mnems.begin() ? "," : "") + *mi;
+	}
+	printf("/* Decode Table Entries */\n\n");
+	printf("template <%s>\n", params.c_str());
+	printf("struct decode_table\n");
+	printf("{\n");
+	printf("\tstatic const uint16_t ent[%lu];\n", base);
+	printf("};\n\n");
+	printf("template <%s>\n", params.c_str());
+	printf("const uint16_t decode_table<%s>::ent[%lu] = {\n", args.c_str(), base);
+	for (size_t i = 0; i < nodes.size(); i++) {
+		printf("\t/* node %lu %s */\n", i, comments[i].c_str());
+		// wrap entries at 100 columns
+		std::string line;
+		for (auto &ent : nodes[i].ents) {
+			std::string str = ent.link < 0 ? ent.leaf :
+				format_string("decode_table_link | %lu", ent.link);
+			if (line.size() > 0 && line.size() + str.size() + 2 > 100) {
+				printf("\t%s\n", line.c_str());
+				line.clear();
+			}
+			line += (line.size() > 0 ? " " : "") + str + ",";
+		}
+		if (line.size() > 0) printf("\t%s\n", line.c_str());
+	}
+	printf("};\n\n");
+
+	// print opcode decoder
+	printf("/* Decode Instruction Opcode using the Decode Table */\n\n");
+	printf("template <%s>\n", params.c_str());
+	printf("inline opcode_t decode_inst_op_table(riscv::inst_t inst)\n");
+	printf("{\n");
+	printf("\tconst uint16_t *ent = decode_table<%s>::ent;\n", args.c_str());
+	printf("\tconst decode_table_node *node = decode_table_nodes;\n");
+	printf("\tfor (;;) {\n");
+	printf("\t\tuint32_t idx = ((inst >> node->shift1) & node->mask1) | ((inst >> node->shift2) & node->mask2);\n");
+	printf("\t\tuint16_t e;\n");
+	printf("\t\tif (node->count == 0) {\n");
+	printf("\t\t\te = ent[node->base + idx];\n");
+	printf("\t\t} else {\n");
+	printf("\t\t\tsize_t i = 0;\n");
+	printf("\t\t\twhile (i < node->count && decode_table_keys[node->key_base + i] != idx) i++;\n");
+	printf("\t\t\te = ent[node->base + i];\n");
+	printf("\t\t}\n");
+	printf("\t\tif (!(e & decode_table_link)) return e;\n");
+	printf("\t\tnode = decode_table_nodes + (e & ~decode_table_link);\n");
+	printf("\t}\n");
+	printf("}\n\n");
+	printf("#endif\n");
+}
+
 void riscv_gen_switch::generate()
 {
-	if (gen->has_option("print_switch_h")) {
+	if (gen->has_option("print_switch_h") || gen->has_option("print_switch_table_h")) {
 		gen->generate_codec();
+	}
+	if (gen->has_option("print_switch_h")) {
 		print_switch_h(gen);
 	}
+	if (gen->has_option("print_switch_table_h")) {
+		print_switch_table_h(gen);
+	}
 }
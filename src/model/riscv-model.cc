@@ -517,6 +517,25 @@ std::vector<std::vector<std::string>> riscv_meta_model::read_file(std::string fi
 	return data;
 }
 
+uint64_t riscv_meta_model::digest_update(uint64_t digest, std::string str)
+{
+	for (size_t i = 0; i <= str.size(); i++) {
+		digest = (digest ^ uint8_t(str.c_str()[i])) * 0x100000001b3ULL;
+	}
+	return digest;
+}
+
+std::vector<std::vector<std::string>> riscv_meta_model::read_file_digest(std::string filename)
+{
+	/* hash the parsed fields so comment and whitespace changes do not alter the digest */
+	std::vector<std::vector<std::string>> data = read_file(filename);
+	for (auto &part : data) {
+		for (auto &field : part) digest = digest_update(digest, field);
+		digest = digest_update(digest, "\n");
+	}
+	return data;
+}
+
 std::vector<std::string> riscv_meta_model::get_unique_codecs()
 {
 	std::vector<std::string> codec_names;
@@ -988,6 +1007,7 @@ void riscv_meta_model::parse_pseudo(std::vector<std::string> &part)
 			// TODO - abstract this inference hack
 			if (operand_name == "none") continue;
 			if (operand_name == "offset") operand_name = "oimm20";
+			if (operand_name == "imm") operand_name = "imm12";
 			riscv_operand_ptr operand = operands_by_name[operand_name];
 			if (!operand) {
 				panic("psuedo opcode %s references unknown operand %s",
@@ -1064,21 +1084,21 @@ void riscv_meta_model::parse_opcode_pseudocode_alt(std::vector<std::string> &par
 
 bool riscv_meta_model::read_metadata(std::string dirname)
 {
-	for (auto part : read_file(dirname + std::string("/") + OPERANDS_FILE)) parse_operand(part);
-	for (auto part : read_file(dirname + std::string("/") + ENUMS_FILE)) parse_enum(part);
-	for (auto part : read_file(dirname + std::string("/") + TYPES_FILE)) parse_type(part);
-	for (auto part : read_file(dirname + std::string("/") + FORMATS_FILE)) parse_format(part);
-	for (auto part : read_file(dirname + std::string("/") + CODECS_FILE)) parse_codec(part);
-	for (auto part : read_file(dirname + std::string("/") + EXTENSIONS_FILE)) parse_extension(part);
-	for (auto part : read_file(dirname + std::string("/") + REGISTERS_FILE)) parse_register(part);
-	for (auto part : read_file(dirname + std::string("/") + CSRS_FILE)) parse_csr(part);
-	for (auto part : read_file(dirname + std::string("/") + OPCODES_FILE)) parse_opcode(part);
-	for (auto part : read_file(dirname + std::string("/") + CONSTRAINTS_FILE)) parse_constraint(part);
-	for (auto part : read_file(dirname + std::string("/") + COMPRESSION_FILE)) parse_compression(part);
-	for (auto part : read_file(dirname + std::string("/") + PSEUDO_FILE)) parse_pseudo(part);
-	for (auto part : read_file(dirname + std::string("/") + OPCODE_FULLNAMES_FILE)) parse_opcode_fullname(part);
-	for (auto part : read_file(dirname + std::string("/") + OPCODE_DESCRIPTIONS_FILE)) parse_opcode_description(part);
-	for (auto part : read_file(dirname + std::string("/") + OPCODE_PSEUDOCODE_C_FILE)) parse_opcode_pseudocode_c(part);
-	for (auto part : read_file(dirname + std::string("/") + OPCODE_PSEUDOCODE_ALT_FILE)) parse_opcode_pseudocode_alt(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + OPERANDS_FILE)) parse_operand(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + ENUMS_FILE)) parse_enum(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + TYPES_FILE)) parse_type(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + FORMATS_FILE)) parse_format(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + CODECS_FILE)) parse_codec(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + EXTENSIONS_FILE)) parse_extension(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + REGISTERS_FILE)) parse_register(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + CSRS_FILE)) parse_csr(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + OPCODES_FILE)) parse_opcode(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + CONSTRAINTS_FILE)) parse_constraint(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + COMPRESSION_FILE)) parse_compression(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + PSEUDO_FILE)) parse_pseudo(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + OPCODE_FULLNAMES_FILE)) parse_opcode_fullname(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + OPCODE_DESCRIPTIONS_FILE)) parse_opcode_description(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + OPCODE_PSEUDOCODE_C_FILE)) parse_opcode_pseudocode_c(part);
+	for (auto part : read_file_digest(dirname + std::string("/") + OPCODE_PSEUDOCODE_ALT_FILE)) parse_opcode_pseudocode_alt(part);
 	return true;
 }
@@ -374,6 +374,7 @@ struct riscv_meta_model
 	riscv_compressed_list    compressions;
 	riscv_pseudo_list        pseudos;
 	riscv_pseudo_map         pseudos_by_name;
+	uint64_t                 digest = 0xcbf29ce484222325ULL; /* FNV-1a of the metadata read */
 
 	static riscv_opcode_mask decode_mask(std::string bit_spec);
 	static std::string opcode_mask(riscv_opcode_ptr opcode);
@@ -390,6 +391,8 @@ struct riscv_meta_model
 	static const riscv_primitive_type* infer_operand_primitive(riscv_opcode_ptr &opcode, riscv_extension_ptr &ext, riscv_operand_ptr &operand, size_t i);
 	static std::vector<std::string> parse_line(std::string line);
 	static std::vector<std::vector<std::string>> read_file(std::string filename);
+	static uint64_t digest_update(uint64_t digest, std::string str);
+	std::vector<std::vector<std::string>> read_file_digest(std::string filename);
 
 	std::vector<std::string> get_unique_codecs();
 	std::vector<std::string> get_inst_mnemonics(bool isa_widths, bool isa_extensions);